@@ -5,13 +5,26 @@
 #include <iomanip>
 #include <algorithm>
 
-BaseController::BaseController() {
-    db = DatabaseConnection::getInstance();
-}
+DatabaseClient::DatabaseClient() : router(ConnectionRouter::getInstance()), pool(router->getPrimary()) {}
+
+DatabaseClient::DatabaseClient(std::shared_ptr<ConnectionPool> pool)
+    : router(std::make_shared<ConnectionRouter>(pool)), pool(pool) {}
+
+DatabaseClient::DatabaseClient(std::shared_ptr<ConnectionRouter> router)
+    : router(router), pool(router->getPrimary()) {}
+
+bool DatabaseClient::initializeDatabase() {
+    if (!db) {
+        lease = pool->acquire();
+        if (!lease) {
+            std::cerr << "Failed to acquire a database connection from the pool" << std::endl;
+            return false;
+        }
+        db = lease.get();
+    }
 
-bool BaseController::initializeDatabase() {
     if (!db->isConnected()) {
-        if (!db->connect()) {
+        if (!db->reconnect()) {
             std::cerr << "Failed to connect to database" << std::endl;
             return false;
         }
@@ -19,6 +32,47 @@ bool BaseController::initializeDatabase() {
     return true;
 }
 
+bool DatabaseClient::initializeReadDatabase() {
+    if (!router->hasReplicas()) {
+        readDb = nullptr;
+        readLease.release();
+        if (!initializeDatabase()) {
+            return false;
+        }
+        readDb = db;
+        return true;
+    }
+
+    std::chrono::milliseconds window = router->getReadYourWritesWindow();
+    if (db && window.count() > 0 && db->getLastWriteTime() + window > std::chrono::steady_clock::now()) {
+        readDb = db;
+        return true;
+    }
+
+    // A fresh lease per read call spreads load across the replicas.
+    readDb = nullptr;
+    readLease.release();
+    readLease = router->acquireRead();
+    if (!readLease) {
+        std::cerr << "Failed to acquire a read connection" << std::endl;
+        return false;
+    }
+    readDb = readLease.get();
+
+    if (!readDb->isConnected() && !readDb->reconnect()) {
+        std::cerr << "Failed to connect to database" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void DatabaseClient::releaseConnection() {
+    readDb = nullptr;
+    readLease.release();
+    db = nullptr;
+    lease.release();
+}
+
 std::string BaseController::escapeJsonString(const std::string& input) const {
     std::string escaped = input;
 
@@ -51,7 +105,7 @@ std::string BaseController::escapeJsonString(const std::string& input) const {
     return escaped;
 }
 
-std::string BaseController::escapeCsvField(const std::string& input) const {
+std::string BaseController::escapeCsvField(const std::string& input) {
     std::string escaped = input;
 
     if (escaped.find(',') != std::string::npos ||
@@ -111,4 +165,22 @@ std::string BaseController::formatDateForDb(const std::string& date) const {
         return "NULL";
     }
     return "'" + date + "'";
+}
+
+std::string DatabaseClient::toArrayLiteral(const std::vector<std::string>& values) const {
+    std::string literal = "{";
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i > 0) {
+            literal += ',';
+        }
+        literal += '"';
+        for (char c : values[i]) {
+            if (c == '"' || c == '\\') {
+                literal += '\\';
+            }
+            literal += c;
+        }
+        literal += '"';
+    }
+    return literal + "}";
 }
\ No newline at end of file
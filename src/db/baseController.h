@@ -2,26 +2,58 @@
 #define BASECONTROLLER_H
 
 #include "database.h"
+#include "connectionPool.h"
+#include "connectionRouter.h"
 #include <string>
 #include <vector>
 #include <memory>
 
-class BaseController {
+// Leases connections from a router: `db` on the primary for writes and
+// `readDb` for reads. Controllers that run SQL themselves and storage
+// classes derive from it; controllers that delegate to a repository don't.
+class DatabaseClient {
 protected:
+    std::shared_ptr<ConnectionRouter> router;
+    std::shared_ptr<ConnectionPool> pool;
+    PooledConnection lease;
     std::shared_ptr<DatabaseConnection> db;
 
+    // Connection for read-only methods: a replica when the router has one,
+    // otherwise (or right after this client wrote) the primary `db`.
+    PooledConnection readLease;
+    std::shared_ptr<DatabaseConnection> readDb;
+
 public:
-    BaseController();
-    virtual ~BaseController() = default;
+    DatabaseClient();
+    explicit DatabaseClient(std::shared_ptr<ConnectionPool> pool);
+    explicit DatabaseClient(std::shared_ptr<ConnectionRouter> router);
+    virtual ~DatabaseClient() = default;
 
     virtual bool initializeDatabase();
+    bool initializeReadDatabase();
+    void releaseConnection();
+
+protected:
+    // Text array literal for a `$n::text[]` parameter, e.g. {"a","b\"c"}.
+    std::string toArrayLiteral(const std::vector<std::string>& values) const;
+};
+
+// Import/export interface and the text helpers behind it. Holds no
+// database state.
+class BaseController {
+public:
+    virtual ~BaseController() = default;
+
     virtual std::string exportToJson() = 0;
     virtual std::string exportToCsv() = 0;
     virtual bool importFromJson(const std::string& jsonData) = 0;
 
+    // Quotes a field that holds a comma, quote or line break. Shared with
+    // the repositories' CSV exports.
+    static std::string escapeCsvField(const std::string& input);
+
 protected:
     std::string escapeJsonString(const std::string& input) const;
-    std::string escapeCsvField(const std::string& input) const;
     std::vector<std::string> splitCsvLine(const std::string& line) const;
     std::string getCurrentTimestamp() const;
     std::string formatDateForDb(const std::string& date) const;
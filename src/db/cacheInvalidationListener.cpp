@@ -0,0 +1,81 @@
+#include "cacheInvalidationListener.h"
+#include <iostream>
+
+const char* const CacheInvalidationListener::CHANGE_CHANNEL = "rezz_table_changes";
+
+// Bounds how long stop() waits for the listener thread to notice.
+static const int POLL_INTERVAL_MS = 200;
+
+CacheInvalidationListener::CacheInvalidationListener(std::shared_ptr<DatabaseConnection> connection,
+                                                     std::shared_ptr<QueryCache> cache,
+                                                     const std::string& channel)
+    : connection(connection), cache(cache), channel(channel), running(false), notifications(0) {
+    // The listener's own LISTEN/UNLISTEN statements must not touch the cache.
+    connection->setResultCache(nullptr);
+}
+
+CacheInvalidationListener::~CacheInvalidationListener() {
+    stop();
+}
+
+bool CacheInvalidationListener::start() {
+    if (running) {
+        return true;
+    }
+
+    if (!connection->isConnected() && !connection->connect()) {
+        std::cerr << "Cache invalidation listener could not connect" << std::endl;
+        return false;
+    }
+    if (!connection->listen(channel)) {
+        return false;
+    }
+
+    running = true;
+    worker = std::thread(&CacheInvalidationListener::run, this);
+    return true;
+}
+
+void CacheInvalidationListener::stop() {
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+        connection->unlisten(channel);
+    }
+}
+
+bool CacheInvalidationListener::isRunning() const {
+    return running;
+}
+
+unsigned long long CacheInvalidationListener::getNotificationCount() const {
+    return notifications;
+}
+
+std::string CacheInvalidationListener::tableFromPayload(const std::string& payload) {
+    return payload.substr(0, payload.find(':'));
+}
+
+void CacheInvalidationListener::run() {
+    DatabaseConnection::NotificationHandler invalidate =
+        [this](const std::string&, const std::string& payload, int) {
+            notifications++;
+            cache->invalidateTable(tableFromPayload(payload));
+        };
+
+    while (running) {
+        if (connection->pollNotifications(POLL_INTERVAL_MS, invalidate)) {
+            continue;
+        }
+
+        // Writes go unannounced until we are back, so nothing cached can be
+        // trusted. reconnect() backs off between attempts and re-subscribes.
+        std::cerr << "Cache invalidation listener lost its connection; reconnecting" << std::endl;
+        cache->clear();
+        if (connection->reconnect()) {
+            cache->clear();
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(POLL_INTERVAL_MS));
+        }
+    }
+}
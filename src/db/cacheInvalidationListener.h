@@ -0,0 +1,50 @@
+#ifndef CACHEINVALIDATIONLISTENER_H
+#define CACHEINVALIDATIONLISTENER_H
+
+#include "database.h"
+#include "queryCache.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Keeps a QueryCache coherent with writes from other processes. The schema's
+// notify_table_change() trigger sends the table name on CHANGE_CHANNEL after
+// every statement that changes it. A background thread LISTENs on a dedicated connection and
+// drops the cached results that read that table. If the connection drops,
+// notifications may have been missed, so the whole cache is cleared once
+// it is back.
+class CacheInvalidationListener {
+private:
+    std::shared_ptr<DatabaseConnection> connection;
+    std::shared_ptr<QueryCache> cache;
+    std::string channel;
+    std::thread worker;
+    std::atomic<bool> running;
+    std::atomic<unsigned long long> notifications;
+
+    void run();
+
+public:
+    static const char* const CHANGE_CHANNEL;
+
+    // The connection must not be used by anything else while listening.
+    CacheInvalidationListener(std::shared_ptr<DatabaseConnection> connection, std::shared_ptr<QueryCache> cache,
+                              const std::string& channel = CHANGE_CHANNEL);
+    ~CacheInvalidationListener();
+
+    CacheInvalidationListener(const CacheInvalidationListener&) = delete;
+    CacheInvalidationListener& operator=(const CacheInvalidationListener&) = delete;
+
+    // Connects if needed, subscribes and starts the listener thread.
+    bool start();
+    void stop();
+    bool isRunning() const;
+    unsigned long long getNotificationCount() const;
+
+    // "job_applications" -> "job_applications"; a ":key" suffix, as sent by
+    // the row-level triggers of older schemas, is ignored.
+    static std::string tableFromPayload(const std::string& payload);
+};
+
+#endif // CACHEINVALIDATIONLISTENER_H
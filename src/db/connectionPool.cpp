@@ -0,0 +1,304 @@
+#include "connectionPool.h"
+#include <iostream>
+#include <vector>
+
+std::shared_ptr<ConnectionPool> ConnectionPool::instance = nullptr;
+std::mutex ConnectionPool::instanceMutex;
+
+ConnectionPoolConfig::ConnectionPoolConfig()
+    : host("localhost"), port("5432"), dbname("rezz_db"), user("postgres"), password("postgres"),
+      minSize(1), maxSize(8), acquireTimeout(5000), healthCheckInterval(30000), binaryResults(false) {}
+
+PooledConnection::PooledConnection() {}
+
+PooledConnection::PooledConnection(std::shared_ptr<DatabaseConnection> connection,
+                                   std::weak_ptr<ConnectionPool> pool)
+    : connection(connection), pool(pool) {}
+
+PooledConnection::PooledConnection(PooledConnection&& other)
+    : connection(std::move(other.connection)), pool(std::move(other.pool)) {
+    other.connection = nullptr;
+}
+
+PooledConnection& PooledConnection::operator=(PooledConnection&& other) {
+    if (this != &other) {
+        release();
+        connection = std::move(other.connection);
+        pool = std::move(other.pool);
+        other.connection = nullptr;
+    }
+    return *this;
+}
+
+PooledConnection::~PooledConnection() {
+    release();
+}
+
+std::shared_ptr<DatabaseConnection> PooledConnection::get() const {
+    return connection;
+}
+
+DatabaseConnection* PooledConnection::operator->() const {
+    return connection.get();
+}
+
+PooledConnection::operator bool() const {
+    return connection != nullptr;
+}
+
+void PooledConnection::release() {
+    if (!connection) {
+        return;
+    }
+
+    std::shared_ptr<ConnectionPool> owner = pool.lock();
+    if (owner) {
+        owner->release(connection);
+    }
+    connection = nullptr;
+}
+
+ConnectionPool::ConnectionPool(const ConnectionPoolConfig& config)
+    : config(config), totalConnections(0), closed(false), connectFailed(false) {
+    if (this->config.maxSize == 0) {
+        this->config.maxSize = 1;
+    }
+    if (this->config.minSize > this->config.maxSize) {
+        this->config.minSize = this->config.maxSize;
+    }
+}
+
+ConnectionPool::~ConnectionPool() {
+    close();
+}
+
+bool ConnectionPool::initialize() {
+    std::unique_lock<std::mutex> lock(mutex);
+    closed = false;
+
+    while (totalConnections < config.minSize) {
+        totalConnections++;
+        lock.unlock();
+        std::shared_ptr<DatabaseConnection> connection = createConnection();
+        lock.lock();
+
+        if (!connection) {
+            totalConnections--;
+            return false;
+        }
+
+        idle.push_back({connection, std::chrono::steady_clock::now()});
+    }
+
+    available.notify_all();
+    return true;
+}
+
+void ConnectionPool::close() {
+    std::deque<IdleConnection> drained;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        totalConnections -= idle.size();
+        drained.swap(idle);
+    }
+    available.notify_all();
+}
+
+PooledConnection ConnectionPool::acquire() {
+    return acquire(config.acquireTimeout);
+}
+
+PooledConnection ConnectionPool::tryAcquire() {
+    return acquire(std::chrono::milliseconds(0));
+}
+
+PooledConnection ConnectionPool::acquire(std::chrono::milliseconds timeout) {
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!closed) {
+        if (!idle.empty()) {
+            // LIFO keeps the most recently used connections warm and lets
+            // the rest age out through the health check.
+            IdleConnection entry = idle.back();
+            idle.pop_back();
+            lock.unlock();
+
+            if (isHealthy(entry)) {
+                return PooledConnection(entry.connection, shared_from_this());
+            }
+
+            entry.connection->disconnect();
+            bool reconnected = entry.connection->connect();
+
+            lock.lock();
+            connectFailed = !reconnected;
+            if (reconnected) {
+                lock.unlock();
+                return PooledConnection(entry.connection, shared_from_this());
+            }
+            totalConnections--;
+            continue;
+        }
+
+        if (totalConnections < config.maxSize) {
+            totalConnections++;
+            lock.unlock();
+
+            std::shared_ptr<DatabaseConnection> connection = createConnection();
+            if (connection) {
+                return PooledConnection(connection, shared_from_this());
+            }
+
+            discard();
+            return PooledConnection();
+        }
+
+        if (timeout.count() <= 0) {
+            break;
+        }
+
+        if (available.wait_until(lock, deadline) == std::cv_status::timeout &&
+            idle.empty() && totalConnections >= config.maxSize) {
+            std::cerr << "Connection pool exhausted: no connection available after "
+                      << timeout.count() << "ms" << std::endl;
+            break;
+        }
+    }
+
+    return PooledConnection();
+}
+
+void ConnectionPool::healthCheck() {
+    std::deque<IdleConnection> checking;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) {
+            return;
+        }
+        checking.swap(idle);
+    }
+
+    std::vector<IdleConnection> healthy;
+    size_t dropped = 0;
+    for (const auto& entry : checking) {
+        if (entry.connection->ping()) {
+            healthy.push_back({entry.connection, std::chrono::steady_clock::now()});
+        } else {
+            dropped++;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    totalConnections -= dropped;
+    for (const auto& entry : healthy) {
+        idle.push_back(entry);
+    }
+
+    while (!closed && totalConnections < config.minSize) {
+        totalConnections++;
+        lock.unlock();
+        std::shared_ptr<DatabaseConnection> connection = createConnection();
+        lock.lock();
+
+        if (!connection) {
+            totalConnections--;
+            break;
+        }
+        idle.push_back({connection, std::chrono::steady_clock::now()});
+    }
+
+    available.notify_all();
+}
+
+size_t ConnectionPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalConnections;
+}
+
+size_t ConnectionPool::idleCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return idle.size();
+}
+
+size_t ConnectionPool::inUseCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalConnections - idle.size();
+}
+
+bool ConnectionPool::lastConnectFailed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return connectFailed;
+}
+
+const ConnectionPoolConfig& ConnectionPool::getConfig() const {
+    return config;
+}
+
+std::shared_ptr<ConnectionPool> ConnectionPool::getInstance() {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (!instance) {
+        instance = std::make_shared<ConnectionPool>();
+    }
+    return instance;
+}
+
+void ConnectionPool::setInstance(std::shared_ptr<ConnectionPool> instance) {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    ConnectionPool::instance = instance;
+}
+
+std::shared_ptr<DatabaseConnection> ConnectionPool::createConnection() {
+    std::shared_ptr<DatabaseConnection> connection = std::make_shared<DatabaseConnection>(
+        config.host, config.port, config.dbname, config.user, config.password);
+
+    bool connected = connection->connect();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        connectFailed = !connected;
+    }
+    if (!connected) {
+        return nullptr;
+    }
+    connection->setBinaryResults(config.binaryResults);
+    return connection;
+}
+
+bool ConnectionPool::isHealthy(const IdleConnection& entry) const {
+    if (!entry.connection->isConnected()) {
+        return false;
+    }
+
+    if (std::chrono::steady_clock::now() - entry.idleSince >= config.healthCheckInterval) {
+        return entry.connection->ping();
+    }
+    return true;
+}
+
+void ConnectionPool::release(std::shared_ptr<DatabaseConnection> connection) {
+    if (connection->inTransaction()) {
+        std::cerr << "Connection returned to pool with an open transaction; rolling back" << std::endl;
+        connection->rollbackTransaction();
+    }
+
+    bool reusable = connection->isConnected();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed || !reusable) {
+            totalConnections--;
+        } else {
+            idle.push_back({connection, std::chrono::steady_clock::now()});
+        }
+    }
+    available.notify_one();
+}
+
+void ConnectionPool::discard() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        totalConnections--;
+    }
+    available.notify_one();
+}
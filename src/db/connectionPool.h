@@ -0,0 +1,116 @@
+#ifndef CONNECTIONPOOL_H
+#define CONNECTIONPOOL_H
+
+#include "database.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+struct ConnectionPoolConfig {
+    std::string host;
+    std::string port;
+    std::string dbname;
+    std::string user;
+    std::string password;
+
+    size_t minSize;
+    size_t maxSize;
+
+    // How long acquire() waits for a connection when the pool is exhausted.
+    // Zero makes acquire() fail fast instead of blocking.
+    std::chrono::milliseconds acquireTimeout;
+
+    // Idle connections older than this are pinged before being handed out.
+    std::chrono::milliseconds healthCheckInterval;
+
+    // Request binary-format results on pooled connections. Off by default:
+    // getString() renders timestamptz in UTC and has no text form for types
+    // it does not decode (json, uuid, interval, arrays), so only enable it
+    // for queries that read the decoded types.
+    bool binaryResults;
+
+    ConnectionPoolConfig();
+};
+
+class ConnectionPool;
+
+// RAII handle for a checked-out connection; returns it to the pool on destruction.
+class PooledConnection {
+private:
+    std::shared_ptr<DatabaseConnection> connection;
+    std::weak_ptr<ConnectionPool> pool;
+
+public:
+    PooledConnection();
+    PooledConnection(std::shared_ptr<DatabaseConnection> connection, std::weak_ptr<ConnectionPool> pool);
+    PooledConnection(PooledConnection&& other);
+    PooledConnection& operator=(PooledConnection&& other);
+    PooledConnection(const PooledConnection&) = delete;
+    PooledConnection& operator=(const PooledConnection&) = delete;
+    ~PooledConnection();
+
+    std::shared_ptr<DatabaseConnection> get() const;
+    DatabaseConnection* operator->() const;
+    explicit operator bool() const;
+
+    void release();
+};
+
+// Thread-safe pool of DatabaseConnections. Must be owned by a std::shared_ptr
+// so handles can return connections safely even if they outlive a caller.
+class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
+private:
+    struct IdleConnection {
+        std::shared_ptr<DatabaseConnection> connection;
+        std::chrono::steady_clock::time_point idleSince;
+    };
+
+    ConnectionPoolConfig config;
+    std::deque<IdleConnection> idle;
+    size_t totalConnections;
+    bool closed;
+    // Whether the most recent attempt to open a connection failed.
+    bool connectFailed;
+    mutable std::mutex mutex;
+    std::condition_variable available;
+
+public:
+    explicit ConnectionPool(const ConnectionPoolConfig& config = ConnectionPoolConfig());
+    ~ConnectionPool();
+
+    bool initialize();
+    void close();
+
+    PooledConnection acquire();
+    PooledConnection acquire(std::chrono::milliseconds timeout);
+    PooledConnection tryAcquire();
+
+    void healthCheck();
+
+    size_t size() const;
+    size_t idleCount() const;
+    size_t inUseCount() const;
+    // True once opening a connection has failed, until one succeeds again:
+    // the server is likely down rather than the pool merely busy.
+    bool lastConnectFailed() const;
+    const ConnectionPoolConfig& getConfig() const;
+
+    static std::shared_ptr<ConnectionPool> getInstance();
+    static void setInstance(std::shared_ptr<ConnectionPool> instance);
+
+private:
+    friend class PooledConnection;
+
+    static std::shared_ptr<ConnectionPool> instance;
+    static std::mutex instanceMutex;
+
+    std::shared_ptr<DatabaseConnection> createConnection();
+    bool isHealthy(const IdleConnection& entry) const;
+    void release(std::shared_ptr<DatabaseConnection> connection);
+    void discard();
+};
+
+#endif // CONNECTIONPOOL_H
@@ -0,0 +1,171 @@
+#include "connectionRouter.h"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+std::shared_ptr<ConnectionRouter> ConnectionRouter::instance = nullptr;
+std::mutex ConnectionRouter::instanceMutex;
+
+ConnectionRouterConfig::ConnectionRouterConfig()
+    : strategy(ReadStrategy::ROUND_ROBIN), readYourWritesWindow(2000) {}
+
+ConnectionRouter::ReplicaHealth::ReplicaHealth() : backoff(0) {}
+
+ConnectionRouter::ConnectionRouter(std::shared_ptr<ConnectionPool> primary, const ConnectionRouterConfig& config)
+    : primary(primary), strategy(config.strategy), readYourWritesWindow(config.readYourWritesWindow),
+      replicaBackoff(config.replicaBackoff), jitter(std::random_device()()), nextReplica(0) {
+    for (const auto& replicaConfig : config.replicas) {
+        replicas.push_back(std::make_shared<ConnectionPool>(replicaConfig));
+        replicaHealth.emplace_back();
+    }
+}
+
+bool ConnectionRouter::initialize() {
+    if (!primary->initialize()) {
+        return false;
+    }
+
+    std::vector<std::shared_ptr<ConnectionPool>> current;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        current = replicas;
+    }
+
+    // A replica that is down is not fatal; reads skip it until it recovers.
+    for (size_t i = 0; i < current.size(); i++) {
+        if (!current[i]->initialize()) {
+            std::cerr << "Replica " << i << " (" << current[i]->getConfig().host << ":"
+                      << current[i]->getConfig().port << ") unavailable; reads will skip it" << std::endl;
+            markReplicaDown(current[i]);
+        }
+    }
+    return true;
+}
+
+void ConnectionRouter::addReplica(std::shared_ptr<ConnectionPool> replica) {
+    std::lock_guard<std::mutex> lock(mutex);
+    replicas.push_back(replica);
+    replicaHealth.emplace_back();
+}
+
+std::shared_ptr<ConnectionPool> ConnectionRouter::getPrimary() const {
+    return primary;
+}
+
+size_t ConnectionRouter::getReplicaCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return replicas.size();
+}
+
+size_t ConnectionRouter::getHealthyReplicaCount() const {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t healthy = 0;
+    for (const auto& health : replicaHealth) {
+        if (health.retryAt <= now) {
+            healthy++;
+        }
+    }
+    return healthy;
+}
+
+bool ConnectionRouter::hasReplicas() const {
+    return getReplicaCount() > 0;
+}
+
+std::chrono::milliseconds ConnectionRouter::getReadYourWritesWindow() const {
+    return readYourWritesWindow;
+}
+
+PooledConnection ConnectionRouter::acquireWrite() {
+    return primary->acquire();
+}
+
+PooledConnection ConnectionRouter::acquireRead() {
+    std::vector<std::shared_ptr<ConnectionPool>> current;
+    {
+        // Replicas still backing off after a failed connect are left out.
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 0; i < replicas.size(); i++) {
+            if (replicaHealth[i].retryAt <= now) {
+                current.push_back(replicas[i]);
+            }
+        }
+    }
+
+    if (current.empty()) {
+        return primary->acquire();
+    }
+
+    size_t first = nextReplica++ % current.size();
+    if (strategy == ReadStrategy::LEAST_LOADED) {
+        size_t leastBusy = std::numeric_limits<size_t>::max();
+        for (size_t offset = 0; offset < current.size(); offset++) {
+            size_t index = (first + offset) % current.size();
+            size_t busy = current[index]->inUseCount();
+            if (busy < leastBusy) {
+                leastBusy = busy;
+                first = index;
+            }
+        }
+    }
+
+    // Don't queue behind a saturated or dead replica when another can serve.
+    for (size_t offset = 0; offset < current.size(); offset++) {
+        const std::shared_ptr<ConnectionPool>& replica = current[(first + offset) % current.size()];
+        PooledConnection connection = replica->tryAcquire();
+        if (connection) {
+            markReplicaUp(replica);
+            return connection;
+        }
+        if (replica->lastConnectFailed()) {
+            markReplicaDown(replica);
+        }
+    }
+
+    return primary->acquire();
+}
+
+void ConnectionRouter::markReplicaDown(const std::shared_ptr<ConnectionPool>& replica) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < replicas.size(); i++) {
+        if (replicas[i] != replica) {
+            continue;
+        }
+        ReplicaHealth& health = replicaHealth[i];
+        health.backoff = health.backoff.count() == 0
+            ? replicaBackoff.initialBackoff
+            : std::min(health.backoff * 2, replicaBackoff.maxBackoff);
+
+        // Equal jitter, as in DatabaseConnection::reconnect(), so readers
+        // don't all probe the replica at the same moment.
+        long long half = health.backoff.count() / 2;
+        std::uniform_int_distribution<long long> spread(0, health.backoff.count() - half);
+        health.retryAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(half + spread(jitter));
+        return;
+    }
+}
+
+void ConnectionRouter::markReplicaUp(const std::shared_ptr<ConnectionPool>& replica) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < replicas.size(); i++) {
+        if (replicas[i] == replica) {
+            replicaHealth[i] = ReplicaHealth();
+            return;
+        }
+    }
+}
+
+std::shared_ptr<ConnectionRouter> ConnectionRouter::getInstance() {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (!instance) {
+        instance = std::make_shared<ConnectionRouter>(ConnectionPool::getInstance());
+    }
+    return instance;
+}
+
+void ConnectionRouter::setInstance(std::shared_ptr<ConnectionRouter> instance) {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    ConnectionRouter::instance = instance;
+}
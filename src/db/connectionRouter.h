@@ -0,0 +1,87 @@
+#ifndef CONNECTIONROUTER_H
+#define CONNECTIONROUTER_H
+
+#include "connectionPool.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+enum class ReadStrategy {
+    ROUND_ROBIN,
+    LEAST_LOADED
+};
+
+struct ConnectionRouterConfig {
+    std::vector<ConnectionPoolConfig> replicas;
+    ReadStrategy strategy;
+
+    // After a controller writes, its reads stay on the primary for this long
+    // so it sees its own changes despite replica lag. Zero disables pinning.
+    std::chrono::milliseconds readYourWritesWindow;
+
+    // A replica that fails to connect is skipped for initialBackoff, doubling
+    // per further failure up to maxBackoff, so reads don't each wait out
+    // the connect timeout of a server that is down.
+    DatabaseConnection::ReconnectPolicy replicaBackoff;
+
+    ConnectionRouterConfig();
+};
+
+// Routes writes to a primary pool and read-only work to replica pools.
+// Replicas that cannot hand out a connection are skipped; with none
+// available reads fall back to the primary.
+class ConnectionRouter {
+private:
+    struct ReplicaHealth {
+        // Reads skip the replica until then.
+        std::chrono::steady_clock::time_point retryAt;
+        // Zero while the replica is healthy.
+        std::chrono::milliseconds backoff;
+
+        ReplicaHealth();
+    };
+
+    std::shared_ptr<ConnectionPool> primary;
+    std::vector<std::shared_ptr<ConnectionPool>> replicas;
+    // Parallel to replicas; guarded by mutex.
+    std::vector<ReplicaHealth> replicaHealth;
+    ReadStrategy strategy;
+    std::chrono::milliseconds readYourWritesWindow;
+    DatabaseConnection::ReconnectPolicy replicaBackoff;
+    std::mt19937 jitter;
+    std::atomic<size_t> nextReplica;
+    mutable std::mutex mutex;
+
+    static std::shared_ptr<ConnectionRouter> instance;
+    static std::mutex instanceMutex;
+
+    void markReplicaDown(const std::shared_ptr<ConnectionPool>& replica);
+    void markReplicaUp(const std::shared_ptr<ConnectionPool>& replica);
+
+public:
+    explicit ConnectionRouter(std::shared_ptr<ConnectionPool> primary,
+                              const ConnectionRouterConfig& config = ConnectionRouterConfig());
+
+    bool initialize();
+    void addReplica(std::shared_ptr<ConnectionPool> replica);
+
+    std::shared_ptr<ConnectionPool> getPrimary() const;
+    size_t getReplicaCount() const;
+    // Replicas not currently being skipped after a failed connect.
+    size_t getHealthyReplicaCount() const;
+    bool hasReplicas() const;
+    std::chrono::milliseconds getReadYourWritesWindow() const;
+
+    PooledConnection acquireWrite();
+    PooledConnection acquireRead();
+
+    // Without setInstance() this is created on first use and routes everything
+    // to ConnectionPool::getInstance(), so install a pool before that.
+    static std::shared_ptr<ConnectionRouter> getInstance();
+    static void setInstance(std::shared_ptr<ConnectionRouter> instance);
+};
+
+#endif // CONNECTIONROUTER_H
@@ -2,16 +2,46 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <cerrno>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <ostream>
+#include <poll.h>
+#include <unistd.h>
 
 std::shared_ptr<DatabaseConnection> DatabaseConnection::instance = nullptr;
 
+static const size_t DEFAULT_STATEMENT_CACHE_CAPACITY = 128;
+
+static std::chrono::microseconds elapsedSince(std::chrono::steady_clock::time_point started) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started);
+}
+
+DatabaseConnection::ReconnectPolicy::ReconnectPolicy()
+    : maxAttempts(5), initialBackoff(100), maxBackoff(5000), retryReadOnly(true) {}
+
 DatabaseConnection::DatabaseConnection()
-    : connection(nullptr), connected(false) {}
+    : connection(nullptr), connected(false), reconnectable(false), resultFormat(0),
+      jitter(std::random_device()()), transactionOpen(false), transactionLost(false),
+      statementCacheCapacity(DEFAULT_STATEMENT_CACHE_CAPACITY), evictionDeferred(false),
+      nextStatementId(0),
+      statistics(QueryStatistics::getInstance()), resultCache(QueryCache::getInstance()) {}
 
 DatabaseConnection::DatabaseConnection(const std::string& host, const std::string& port,
                                      const std::string& dbname, const std::string& user,
                                      const std::string& password)
-    : connection(nullptr), connected(false) {
+    : connection(nullptr), connected(false), reconnectable(false), resultFormat(0),
+      jitter(std::random_device()()), transactionOpen(false), transactionLost(false),
+      statementCacheCapacity(DEFAULT_STATEMENT_CACHE_CAPACITY), evictionDeferred(false),
+      nextStatementId(0),
+      statistics(QueryStatistics::getInstance()), resultCache(QueryCache::getInstance()) {
     buildConnectionString(host, port, dbname, user, password);
 }
 
@@ -33,139 +63,1981 @@ bool DatabaseConnection::connect() {
         connectionString = "host=localhost port=5432 dbname=rezz_db user=postgres password=postgres";
     }
 
+    closeConnection();
     connection = PQconnectdb(connectionString.c_str());
 
-    if (PQstatus(connection) != CONNECTION_OK) {
-        std::cerr << "Database connection failed: " << PQerrorMessage(connection) << std::endl;
-        PQfinish(connection);
-        connection = nullptr;
-        connected = false;
-        return false;
+    if (PQstatus(connection) != CONNECTION_OK) {
+        std::cerr << "Database connection failed: " << PQerrorMessage(connection) << std::endl;
+        PQfinish(connection);
+        connection = nullptr;
+        connected = false;
+        return false;
+    }
+
+    connected = true;
+    reconnectable = true;
+    transactionOpen = false;
+    transactionLost = false;
+    reprepareStatements();
+    relistenChannels();
+    return true;
+}
+
+bool DatabaseConnection::connect(const std::string& host, const std::string& port,
+                               const std::string& dbname, const std::string& user,
+                               const std::string& password) {
+    buildConnectionString(host, port, dbname, user, password);
+    return connect();
+}
+
+void DatabaseConnection::disconnect() {
+    reconnectable = false;
+    closeConnection();
+}
+
+void DatabaseConnection::closeConnection() {
+    if (!asyncPending.empty()) {
+        failPendingAsync();
+    }
+
+    if (connection) {
+        PQfinish(connection);
+        connection = nullptr;
+        connected = false;
+    }
+}
+
+bool DatabaseConnection::isConnected() const {
+    return connected && connection && PQstatus(connection) == CONNECTION_OK;
+}
+
+bool DatabaseConnection::reconnect() {
+    std::chrono::milliseconds backoff = reconnectPolicy.initialBackoff;
+    int attempts = std::max(reconnectPolicy.maxAttempts, 1);
+
+    for (int attempt = 1; attempt <= attempts; attempt++) {
+        if (attempt > 1) {
+            // Equal jitter: wait between half and all of the current backoff
+            // so clients that lost the server together do not return together.
+            long long half = backoff.count() / 2;
+            std::uniform_int_distribution<long long> spread(0, backoff.count() - half);
+            std::this_thread::sleep_for(std::chrono::milliseconds(half + spread(jitter)));
+            backoff = std::min(backoff * 2, reconnectPolicy.maxBackoff);
+        }
+
+        if (connect()) {
+            if (attempt > 1) {
+                std::cerr << "Reconnected to database after " << attempt << " attempts" << std::endl;
+            }
+            return true;
+        }
+        std::cerr << "Reconnect attempt " << attempt << " of " << attempts << " failed" << std::endl;
+    }
+    return false;
+}
+
+bool DatabaseConnection::ensureConnected() {
+    if (transactionLost) {
+        std::cerr << "Transaction aborted by a lost connection; roll it back first" << std::endl;
+        return false;
+    }
+
+    if (isConnected()) {
+        return true;
+    }
+
+    // The server rolled the transaction back with the old connection.
+    // Reconnecting here would run the rest of it in autocommit.
+    if (transactionOpen) {
+        std::cerr << "Database connection lost inside a transaction" << std::endl;
+        transactionLost = true;
+        return false;
+    }
+
+    // Only recover connections that dropped underneath us; a connection the
+    // caller never opened or explicitly closed stays closed.
+    if (!reconnectable || reconnectPolicy.maxAttempts <= 0) {
+        std::cerr << "Database not connected" << std::endl;
+        return false;
+    }
+
+    std::cerr << "Database connection lost; reconnecting" << std::endl;
+    return reconnect();
+}
+
+bool DatabaseConnection::connectionLost() const {
+    return reconnectable && reconnectPolicy.maxAttempts > 0 &&
+           connection && PQstatus(connection) == CONNECTION_BAD;
+}
+
+bool DatabaseConnection::canRetry(const std::string& query) const {
+    return reconnectPolicy.retryReadOnly && !inTransaction() && isReadOnlyStatement(query);
+}
+
+bool DatabaseConnection::isReadOnlyStatement(const std::string& query) {
+    std::string upper;
+    upper.reserve(query.size());
+    for (char c : query) {
+        upper += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+
+    size_t start = upper.find_first_not_of(" \t\r\n(");
+    if (start == std::string::npos) {
+        return false;
+    }
+
+    auto startsWith = [&upper, start](const char* keyword) {
+        size_t length = std::strlen(keyword);
+        return upper.compare(start, length, keyword) == 0 &&
+               (start + length == upper.size() || !std::isalnum(static_cast<unsigned char>(upper[start + length])));
+    };
+
+    // Position of `keyword` as a whole word at or after `from`, or npos.
+    auto findWord = [&upper](const char* keyword, size_t from) {
+        size_t length = std::strlen(keyword);
+        for (size_t pos = upper.find(keyword, from); pos != std::string::npos; pos = upper.find(keyword, pos + 1)) {
+            bool boundedLeft = pos == 0 || !(std::isalnum(static_cast<unsigned char>(upper[pos - 1])) || upper[pos - 1] == '_');
+            bool boundedRight = pos + length == upper.size() ||
+                                !(std::isalnum(static_cast<unsigned char>(upper[pos + length])) || upper[pos + length] == '_');
+            if (boundedLeft && boundedRight) {
+                return pos;
+            }
+        }
+        return std::string::npos;
+    };
+
+    if (startsWith("SHOW") || startsWith("VALUES")) {
+        return true;
+    }
+    if (startsWith("COPY")) {
+        // COPY (query) TO reads whatever its query reads; COPY table TO
+        // only reads, COPY table FROM writes.
+        size_t next = upper.find_first_not_of(" \t\r\n", start + 4);
+        if (next != std::string::npos && upper[next] == '(') {
+            return isReadOnlyStatement(query.substr(next + 1));
+        }
+        return findWord("TO", start + 4) < findWord("FROM", start + 4);
+    }
+    if (!startsWith("SELECT") && !startsWith("WITH")) {
+        return false;
+    }
+
+    // SELECT ... INTO and data-modifying CTEs write. Locking reads (FOR
+    // UPDATE / NO KEY UPDATE / SHARE / KEY SHARE) take row locks, so they
+    // are neither retried nor cached either.
+    const char* writes[] = {"INSERT", "UPDATE", "DELETE", "MERGE", "INTO", "NEXTVAL", "SETVAL", "PG_NOTIFY", "SHARE"};
+    for (const char* keyword : writes) {
+        if (findWord(keyword, 0) != std::string::npos) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DatabaseConnection::cacheable(const std::string& query) const {
+    // Inside a transaction reads may see its own uncommitted writes.
+    return resultCache && !inTransaction() && isReadOnlyStatement(query);
+}
+
+bool DatabaseConnection::ping() {
+    if (!isConnected()) {
+        return false;
+    }
+
+    PGresult* result = PQexec(connection, "SELECT 1");
+    bool alive = PQresultStatus(result) == PGRES_TUPLES_OK;
+    PQclear(result);
+    return alive;
+}
+
+bool DatabaseConnection::inTransaction() const {
+    if (transactionLost) {
+        return true;
+    }
+    if (!connection) {
+        return false;
+    }
+
+    PGTransactionStatusType status = PQtransactionStatus(connection);
+    return status == PQTRANS_INTRANS || status == PQTRANS_INERROR || status == PQTRANS_ACTIVE;
+}
+
+PGresult* DatabaseConnection::executeQuery(const std::string& query) {
+    if (!ensureConnected()) {
+        return nullptr;
+    }
+
+    if (!asyncPending.empty()) {
+        waitForAsync();
+    }
+
+    bool caching = cacheable(query);
+    unsigned long long cacheGeneration = 0;
+    if (caching) {
+        cacheKey.assign(query);
+        cacheKey.push_back('\0');
+        cacheKey.push_back(static_cast<char>('0' + resultFormat));
+        PGresult* cached = resultCache->lookup(cacheKey);
+        if (cached) {
+            return cached;
+        }
+        cacheGeneration = resultCache->getGeneration();
+    }
+
+    bool retryable = canRetry(query);
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    PGresult* result = PQexec(connection, query.c_str());
+    if (retryable && connectionLost()) {
+        PQclear(result);
+        result = reconnect() ? PQexec(connection, query.c_str()) : nullptr;
+    }
+    bool failed = PQresultStatus(result) != PGRES_TUPLES_OK && PQresultStatus(result) != PGRES_COMMAND_OK;
+    recordStatement(query, elapsedSince(started), result, failed);
+
+    if (failed) {
+        std::cerr << "Query execution failed: " << PQerrorMessage(connection) << std::endl;
+        PQclear(result);
+        return nullptr;
+    }
+
+    if (caching) {
+        resultCache->store(cacheKey, query, result, cacheGeneration);
+    }
+    return result;
+}
+
+PGresult* DatabaseConnection::executeParameterizedQuery(const std::string& query,
+                                                       const std::vector<std::string>& params) {
+    std::vector<const char*> paramValues;
+    for (const auto& param : params) {
+        paramValues.push_back(param.c_str());
+    }
+
+    return executeBound(query, static_cast<int>(paramValues.size()), paramValues.data(), nullptr, nullptr, nullptr);
+}
+
+PGresult* DatabaseConnection::executeBound(const std::string& query, int count, const char* const* values,
+                                           const int* lengths, const int* formats, const Oid* types) {
+    if (!ensureConnected()) {
+        return nullptr;
+    }
+
+    if (!asyncPending.empty()) {
+        waitForAsync();
+    }
+
+    // Keyed by the query, result format and each parameter's format, type
+    // and bytes.
+    bool caching = cacheable(query);
+    unsigned long long cacheGeneration = 0;
+    if (caching) {
+        cacheKey.assign(query);
+        cacheKey.push_back('\0');
+        cacheKey.push_back(static_cast<char>('0' + resultFormat));
+        for (int i = 0; i < count; i++) {
+            bool binary = formats && formats[i] == 1;
+            int length = !values[i] ? -1 : binary ? lengths[i] : static_cast<int>(std::strlen(values[i]));
+            cacheKey.push_back('\0');
+            cacheKey += std::to_string(types ? types[i] : 0);
+            cacheKey.push_back(binary ? 'b' : 't');
+            cacheKey += std::to_string(length);
+            cacheKey.push_back(':');
+            if (length > 0) {
+                cacheKey.append(values[i], length);
+            }
+        }
+        PGresult* cached = resultCache->lookup(cacheKey);
+        if (cached) {
+            return cached;
+        }
+        cacheGeneration = resultCache->getGeneration();
+    }
+
+    bool retryable = canRetry(query);
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    PGresult* result = execParameterized(query, count, values, lengths, formats, types);
+    if (retryable && connectionLost()) {
+        if (result) {
+            PQclear(result);
+        }
+        result = reconnect() ? execParameterized(query, count, values, lengths, formats, types) : nullptr;
+    }
+
+    bool failed = !result || (PQresultStatus(result) != PGRES_TUPLES_OK && PQresultStatus(result) != PGRES_COMMAND_OK);
+    recordStatement(query, elapsedSince(started), result, failed);
+
+    if (failed) {
+        std::cerr << "Parameterized query execution failed: " << PQerrorMessage(connection) << std::endl;
+        if (result) {
+            PQclear(result);
+        }
+        return nullptr;
+    }
+
+    if (caching) {
+        resultCache->store(cacheKey, query, result, cacheGeneration);
+    }
+    return result;
+}
+
+PGresult* DatabaseConnection::execParameterized(const std::string& query, int count, const char* const* values,
+                                                const int* lengths, const int* formats, const Oid* types) {
+    // A statement prepared with parameter types only accepts those types, so
+    // each type signature gets its own cache entry.
+    bool typed = types && std::any_of(types, types + count, [](Oid type) { return type != 0; });
+    const std::string* key = &query;
+    if (typed) {
+        statementKey.assign(query);
+        statementKey.push_back('\0');
+        for (int i = 0; i < count; i++) {
+            statementKey += std::to_string(types[i]);
+            statementKey.push_back(',');
+        }
+        key = &statementKey;
+    }
+
+    PGresult* result = nullptr;
+    const PreparedStatement* statement = prepareStatement(*key, typed ? types : nullptr, typed ? count : 0);
+    if (statement) {
+        result = PQexecPrepared(connection, statement->name.c_str(), count,
+                                values, lengths, formats, resultFormat);
+
+        // The server can lose a statement behind our back (DISCARD ALL, pooler
+        // reset); drop the stale entry and retry once with a fresh prepare.
+        const char* sqlState = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+        if (sqlState && std::string(sqlState) == "26000") {
+            PQclear(result);
+            forgetPreparedStatement(*key);
+            statement = prepareStatement(*key, typed ? types : nullptr, typed ? count : 0);
+            result = statement
+                ? PQexecPrepared(connection, statement->name.c_str(), count,
+                                 values, lengths, formats, resultFormat)
+                : nullptr;
+        }
+    } else if (statementCacheCapacity == 0) {
+        result = PQexecParams(connection, query.c_str(), count,
+                              types, values, lengths, formats, resultFormat);
+    }
+    return result;
+}
+
+std::future<DatabaseResult> DatabaseConnection::executeAsync(const std::string& query,
+                                                            const std::vector<std::string>& params) {
+    std::shared_ptr<std::promise<DatabaseResult>> promise = std::make_shared<std::promise<DatabaseResult>>();
+    std::future<DatabaseResult> future = promise->get_future();
+
+    if (!executeAsync(query, params, [promise](PGresult* result) { promise->set_value(DatabaseResult(result)); })) {
+        promise->set_value(DatabaseResult(nullptr));
+    }
+    return future;
+}
+
+bool DatabaseConnection::executeAsync(const std::string& query, const std::vector<std::string>& params,
+                                      std::function<void(PGresult*)> callback) {
+    // A connection lost mid-pipeline takes the queued queries with it, so
+    // only reconnect when nothing is in flight.
+    if (!asyncPending.empty() && !isConnected()) {
+        std::cerr << "Database not connected" << std::endl;
+        return false;
+    }
+    if (!ensureConnected()) {
+        return false;
+    }
+
+    // Synchronous prepares are only possible before the pipeline is entered;
+    // once queries are in flight, uncached text goes out unnamed.
+    const PreparedStatement* statement = nullptr;
+    if (asyncPending.empty()) {
+        statement = prepareStatement(query);
+        if (PQenterPipelineMode(connection) != 1) {
+            std::cerr << "Failed to enter pipeline mode: " << PQerrorMessage(connection) << std::endl;
+            return false;
+        }
+        PQsetnonblocking(connection, 1);
+    } else {
+        auto it = preparedStatements.find(query);
+        if (it != preparedStatements.end()) {
+            statement = &it->second;
+        }
+    }
+
+    std::vector<const char*> paramValues;
+    for (const auto& param : params) {
+        paramValues.push_back(param.c_str());
+    }
+
+    int ok = statement
+        ? PQsendQueryPrepared(connection, statement->name.c_str(), paramValues.size(),
+                              paramValues.data(), nullptr, nullptr, resultFormat)
+        : PQsendQueryParams(connection, query.c_str(), paramValues.size(),
+                            nullptr, paramValues.data(), nullptr, nullptr, resultFormat);
+
+    // A sync after each query keeps them independent: one failing does not
+    // abort the others queued behind it.
+    if (!ok || PQpipelineSync(connection) != 1) {
+        std::cerr << "Failed to send async query: " << PQerrorMessage(connection) << std::endl;
+        if (asyncPending.empty()) {
+            finishAsync();
+        }
+        return false;
+    }
+
+    asyncPending.push_back({query, std::chrono::steady_clock::now(), callback, nullptr, false});
+    PQflush(connection);
+    return true;
+}
+
+bool DatabaseConnection::processAsync(int timeoutMs) {
+    if (asyncPending.empty()) {
+        return true;
+    }
+
+    if (!isConnected()) {
+        failPendingAsync();
+        return false;
+    }
+
+    int flushState = PQflush(connection);
+    if (flushState < 0) {
+        failPendingAsync();
+        return false;
+    }
+
+    if (PQisBusy(connection)) {
+        struct pollfd fd;
+        fd.fd = PQsocket(connection);
+        fd.events = POLLIN | (flushState == 1 ? POLLOUT : 0);
+        fd.revents = 0;
+
+        int ready = poll(&fd, 1, timeoutMs);
+        if (ready < 0) {
+            failPendingAsync();
+            return false;
+        }
+        if (ready > 0 && (fd.revents & POLLIN) && !PQconsumeInput(connection)) {
+            std::cerr << "Async query failed: " << PQerrorMessage(connection) << std::endl;
+            failPendingAsync();
+            return false;
+        }
+    }
+
+    return dispatchAsyncResults();
+}
+
+bool DatabaseConnection::waitForAsync() {
+    while (!asyncPending.empty()) {
+        if (!processAsync(-1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t DatabaseConnection::getPendingAsyncCount() const {
+    return asyncPending.size();
+}
+
+int DatabaseConnection::getSocket() const {
+    return connection ? PQsocket(connection) : -1;
+}
+
+bool DatabaseConnection::dispatchAsyncResults() {
+    // Each query yields its result(s), a NULL terminator, then the sync marker.
+    while (!asyncPending.empty() && !PQisBusy(connection)) {
+        PGresult* result = PQgetResult(connection);
+        AsyncQuery& front = asyncPending.front();
+
+        if (!result) {
+            if (front.resultsDone) {
+                break;
+            }
+            front.resultsDone = true;
+            continue;
+        }
+
+        if (PQresultStatus(result) == PGRES_PIPELINE_SYNC) {
+            PQclear(result);
+            AsyncQuery completed = front;
+            asyncPending.pop_front();
+            if (asyncPending.empty()) {
+                finishAsync();
+            }
+
+            PGresult* delivered = completed.result;
+            bool failed = !delivered || (PQresultStatus(delivered) != PGRES_TUPLES_OK &&
+                                         PQresultStatus(delivered) != PGRES_COMMAND_OK);
+            recordStatement(completed.query, elapsedSince(completed.started), delivered, failed);
+            if (delivered && failed) {
+                std::cerr << "Async query execution failed: " << PQresultErrorMessage(delivered) << std::endl;
+                PQclear(delivered);
+                delivered = nullptr;
+            }
+            completed.callback(delivered);
+            continue;
+        }
+
+        if (!front.resultsDone && !front.result) {
+            front.result = result;
+        } else {
+            PQclear(result);
+        }
+    }
+    return true;
+}
+
+void DatabaseConnection::failPendingAsync() {
+    std::deque<AsyncQuery> failed;
+    failed.swap(asyncPending);
+    if (connection) {
+        finishAsync();
+    }
+
+    for (auto& query : failed) {
+        if (query.result) {
+            PQclear(query.result);
+        }
+        query.callback(nullptr);
+    }
+}
+
+void DatabaseConnection::finishAsync() {
+    PQsetnonblocking(connection, 0);
+    if (PQpipelineStatus(connection) != PQ_PIPELINE_OFF) {
+        PQexitPipelineMode(connection);
+    }
+}
+
+bool DatabaseConnection::forEachRow(const std::string& query, const std::function<bool(DatabaseResult&)>& visitor) {
+    return forEachRow(query, std::vector<std::string>(), visitor);
+}
+
+bool DatabaseConnection::forEachRow(const std::string& query, const std::vector<std::string>& params,
+                                    const std::function<bool(DatabaseResult&)>& visitor) {
+    if (!ensureConnected()) {
+        return false;
+    }
+
+    if (!asyncPending.empty()) {
+        waitForAsync();
+    }
+
+    // Once a row has reached the visitor the stream cannot be replayed.
+    bool retryable = canRetry(query);
+    unsigned long long rows = 0;
+    bool success = forEachRowOnce(query, params, visitor, rows);
+    if (!success && rows == 0 && retryable && connectionLost() && reconnect()) {
+        success = forEachRowOnce(query, params, visitor, rows);
+    }
+    return success;
+}
+
+bool DatabaseConnection::forEachRowOnce(const std::string& query, const std::vector<std::string>& params,
+                                        const std::function<bool(DatabaseResult&)>& visitor,
+                                        unsigned long long& rows) {
+    std::vector<const char*> paramValues;
+    for (const auto& param : params) {
+        paramValues.push_back(param.c_str());
+    }
+
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    const PreparedStatement* statement = prepareStatement(query);
+    int sent = statement
+        ? PQsendQueryPrepared(connection, statement->name.c_str(), paramValues.size(),
+                              paramValues.data(), nullptr, nullptr, resultFormat)
+        : PQsendQueryParams(connection, query.c_str(), paramValues.size(),
+                            nullptr, paramValues.data(), nullptr, nullptr, resultFormat);
+    if (!sent) {
+        std::cerr << "Streaming query execution failed: " << PQerrorMessage(connection) << std::endl;
+        recordStatement(query, elapsedSince(started), nullptr, true);
+        return false;
+    }
+
+    if (!PQsetSingleRowMode(connection)) {
+        std::cerr << "Single-row mode unavailable; buffering full result" << std::endl;
+    }
+
+    // Time spent in the visitor is the caller's, not the statement's.
+    std::chrono::steady_clock::duration visitorTime(0);
+    unsigned long long bytes = 0;
+    rows = 0;
+
+    // Every single-row result has the same columns; index the names once.
+    std::shared_ptr<const ResultColumns> columns;
+
+    bool success = true;
+    bool stopped = false;
+    PGresult* result;
+    while ((result = PQgetResult(connection)) != nullptr) {
+        ExecStatusType status = PQresultStatus(result);
+        if (status == PGRES_SINGLE_TUPLE || status == PGRES_TUPLES_OK) {
+            for (int field = 0; field < PQnfields(result) && PQntuples(result) > 0; field++) {
+                bytes += PQgetlength(result, 0, field);
+            }
+            rows += PQntuples(result);
+
+            std::chrono::steady_clock::time_point visitStarted = std::chrono::steady_clock::now();
+            if (!columns) {
+                columns = std::make_shared<ResultColumns>(result);
+            }
+            DatabaseResult row(result, columns);
+            while (!stopped && row.next()) {
+                if (!visitor(row)) {
+                    stopped = true;
+                    if (status == PGRES_SINGLE_TUPLE) {
+                        cancelStreamingQuery();
+                    }
+                }
+            }
+            visitorTime += std::chrono::steady_clock::now() - visitStarted;
+        } else {
+            if (stopped && isQueryCanceled(result)) {
+                // Our own cancel after the visitor stopped; not a failure.
+                PQclear(result);
+                continue;
+            }
+            if (status != PGRES_COMMAND_OK) {
+                std::cerr << "Streaming query execution failed: " << PQresultErrorMessage(result) << std::endl;
+                success = false;
+            }
+            PQclear(result);
+        }
+    }
+
+    recordStatement(query, elapsedSince(started + visitorTime), rows, bytes, !success);
+    return success;
+}
+
+void DatabaseConnection::cancelStreamingQuery() {
+    // Cancelling aborts an open transaction, so inside one the remaining
+    // rows are drained instead.
+    if (inTransaction()) {
+        return;
+    }
+
+    PGcancel* cancel = PQgetCancel(connection);
+    if (!cancel) {
+        return;
+    }
+    char error[256];
+    if (!PQcancel(cancel, error, sizeof(error))) {
+        std::cerr << "Could not cancel streaming query: " << error << std::endl;
+    }
+    PQfreeCancel(cancel);
+}
+
+bool DatabaseConnection::isQueryCanceled(const PGresult* result) {
+    const char* state = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+    return state && std::strcmp(state, "57014") == 0;
+}
+
+bool DatabaseConnection::copyOut(const std::string& copyQuery, std::ostream& out) {
+    return streamCopyOut(copyQuery, [&out](const char* data, int length) {
+        out.write(data, length);
+        return static_cast<bool>(out);
+    });
+}
+
+bool DatabaseConnection::copyOut(const std::string& copyQuery, int fd) {
+    return streamCopyOut(copyQuery, [fd](const char* data, int length) {
+        while (length > 0) {
+            ssize_t written = write(fd, data, length);
+            if (written < 0) {
+                return false;
+            }
+            data += written;
+            length -= static_cast<int>(written);
+        }
+        return true;
+    });
+}
+
+bool DatabaseConnection::streamCopyOut(const std::string& copyQuery,
+                                       const std::function<bool(const char*, int)>& sink) {
+    if (!ensureConnected()) {
+        return false;
+    }
+
+    if (!asyncPending.empty()) {
+        waitForAsync();
+    }
+
+    bool retryable = reconnectPolicy.retryReadOnly && !inTransaction();
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    PGresult* result = PQexec(connection, copyQuery.c_str());
+    if (PQresultStatus(result) != PGRES_COPY_OUT && retryable && connectionLost()) {
+        PQclear(result);
+        result = reconnect() ? PQexec(connection, copyQuery.c_str()) : nullptr;
+    }
+    if (PQresultStatus(result) != PGRES_COPY_OUT) {
+        std::cerr << "COPY TO STDOUT failed: " << PQresultErrorMessage(result) << std::endl;
+        PQclear(result);
+        recordStatement(copyQuery, elapsedSince(started), nullptr, true);
+        return false;
+    }
+    PQclear(result);
+
+    // Once the sink fails we keep reading so the connection returns to idle,
+    // but stop writing.
+    bool sinkOk = true;
+    unsigned long long bytes = 0;
+    unsigned long long rows = 0;
+    char* chunk = nullptr;
+    int length;
+    while ((length = PQgetCopyData(connection, &chunk, 0)) > 0) {
+        bytes += length;
+        if (sinkOk && !sink(chunk, length)) {
+            std::cerr << "COPY TO STDOUT: failed writing output" << std::endl;
+            sinkOk = false;
+        }
+        PQfreemem(chunk);
+        chunk = nullptr;
+    }
+
+    bool success = sinkOk;
+    if (length == -2) {
+        std::cerr << "COPY TO STDOUT failed: " << PQerrorMessage(connection) << std::endl;
+        success = false;
+    }
+
+    while ((result = PQgetResult(connection)) != nullptr) {
+        if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+            std::cerr << "COPY TO STDOUT failed: " << PQresultErrorMessage(result) << std::endl;
+            success = false;
+        } else {
+            rows = std::strtoull(PQcmdTuples(result), nullptr, 10);
+        }
+        PQclear(result);
+    }
+
+    recordStatement(copyQuery, elapsedSince(started), rows, bytes, !success);
+    return success;
+}
+
+bool DatabaseConnection::executeNonQuery(const std::string& query) {
+    PGresult* result = executeQuery(query);
+    if (result) {
+        PQclear(result);
+        return true;
+    }
+    return false;
+}
+
+bool DatabaseConnection::executeParameterizedNonQuery(const std::string& query,
+                                                     const std::vector<std::string>& params) {
+    PGresult* result = executeParameterizedQuery(query, params);
+    if (result) {
+        PQclear(result);
+        return true;
+    }
+    return false;
+}
+
+std::string DatabaseConnection::escapeString(const std::string& input) {
+    if (!isConnected()) {
+        return input;
+    }
+
+    char* escaped = new char[input.length() * 2 + 1];
+    PQescapeStringConn(connection, escaped, input.c_str(), input.length(), nullptr);
+    std::string result(escaped);
+    delete[] escaped;
+    return result;
+}
+
+std::string DatabaseConnection::getLastError() const {
+    if (connection) {
+        return std::string(PQerrorMessage(connection));
+    }
+    return "No connection";
+}
+
+bool DatabaseConnection::beginTransaction() {
+    transactionOpen = executeNonQuery("BEGIN");
+    return transactionOpen;
+}
+
+bool DatabaseConnection::commitTransaction() {
+    bool committed = !transactionLost && executeNonQuery("COMMIT");
+    if (transactionLost) {
+        std::cerr << "Cannot commit: the transaction was rolled back when the connection was lost" << std::endl;
+    }
+    transactionOpen = false;
+    transactionLost = false;
+    return committed;
+}
+
+bool DatabaseConnection::rollbackTransaction() {
+    // A lost connection has already rolled the transaction back, including
+    // one that turns out to be lost only when ROLLBACK is sent.
+    bool rolledBack = transactionLost || executeNonQuery("ROLLBACK");
+    rolledBack = rolledBack || transactionLost;
+    transactionOpen = false;
+    transactionLost = false;
+    return rolledBack;
+}
+
+void DatabaseConnection::setBinaryResults(bool binary) {
+    resultFormat = binary ? 1 : 0;
+}
+
+bool DatabaseConnection::getBinaryResults() const {
+    return resultFormat == 1;
+}
+
+void DatabaseConnection::setReconnectPolicy(const ReconnectPolicy& policy) {
+    reconnectPolicy = policy;
+}
+
+const DatabaseConnection::ReconnectPolicy& DatabaseConnection::getReconnectPolicy() const {
+    return reconnectPolicy;
+}
+
+void DatabaseConnection::setStatistics(std::shared_ptr<QueryStatistics> statistics) {
+    this->statistics = statistics;
+}
+
+std::shared_ptr<QueryStatistics> DatabaseConnection::getStatistics() const {
+    return statistics;
+}
+
+void DatabaseConnection::setResultCache(std::shared_ptr<QueryCache> cache) {
+    resultCache = cache;
+}
+
+std::shared_ptr<QueryCache> DatabaseConnection::getResultCache() const {
+    return resultCache;
+}
+
+void DatabaseConnection::recordStatement(const std::string& query, std::chrono::microseconds elapsed,
+                                         const PGresult* result, bool failed) {
+    unsigned long long rows = 0;
+    unsigned long long bytes = 0;
+    if (result && statistics && statistics->isEnabled()) {
+        int numRows = PQntuples(result);
+        int numFields = PQnfields(result);
+        rows = numRows;
+        for (int row = 0; row < numRows; row++) {
+            for (int field = 0; field < numFields; field++) {
+                bytes += PQgetlength(result, row, field);
+            }
+        }
+    }
+
+    recordStatement(query, elapsed, rows, bytes, failed);
+}
+
+void DatabaseConnection::recordStatement(const std::string& query, std::chrono::microseconds elapsed,
+                                         unsigned long long rows, unsigned long long bytes, bool failed) {
+    if (!failed && !isReadOnlyStatement(query)) {
+        lastWriteTime = std::chrono::steady_clock::now();
+        if (resultCache) {
+            resultCache->invalidateFor(query);
+            if (inTransaction()) {
+                transactionWrites.insert(query);
+            }
+        }
+    }
+
+    // Follow a transaction ended by a plain COMMIT/ROLLBACK statement too.
+    if (transactionOpen && isConnected() && PQtransactionStatus(connection) == PQTRANS_IDLE) {
+        transactionOpen = false;
+    }
+
+    if (!transactionWrites.empty() && !inTransaction()) {
+        if (resultCache) {
+            for (const auto& write : transactionWrites) {
+                resultCache->invalidateFor(write);
+            }
+        }
+        transactionWrites.clear();
+    }
+
+    if (statistics && statistics->isEnabled()) {
+        statistics->record(query, elapsed, rows, bytes, failed);
+    }
+}
+
+std::chrono::steady_clock::time_point DatabaseConnection::getLastWriteTime() const {
+    return lastWriteTime;
+}
+
+void DatabaseConnection::setStatementCacheCapacity(size_t capacity) {
+    statementCacheCapacity = capacity;
+    evictPreparedStatements();
+}
+
+size_t DatabaseConnection::getStatementCacheCapacity() const {
+    return statementCacheCapacity;
+}
+
+size_t DatabaseConnection::getPreparedStatementCount() const {
+    return preparedStatements.size();
+}
+
+void DatabaseConnection::clearStatementCache() {
+    for (const auto& entry : preparedStatements) {
+        pendingDeallocations.push_back(entry.second.name);
+    }
+    preparedStatements.clear();
+    preparedLru.clear();
+    deallocatePendingStatements();
+}
+
+const DatabaseConnection::PreparedStatement* DatabaseConnection::prepareStatement(const std::string& query,
+                                                                                  const Oid* paramTypes,
+                                                                                  int paramCount) {
+    if (statementCacheCapacity == 0) {
+        return nullptr;
+    }
+
+    auto it = preparedStatements.find(query);
+    if (it != preparedStatements.end()) {
+        preparedLru.splice(preparedLru.begin(), preparedLru, it->second.lruPosition);
+        return &it->second;
+    }
+
+    deallocatePendingStatements();
+
+    std::string name = "rezz_stmt_" + std::to_string(++nextStatementId);
+    PGresult* result = PQprepare(connection, name.c_str(), query.c_str(), paramCount, paramTypes);
+    bool prepared = PQresultStatus(result) == PGRES_COMMAND_OK;
+    PQclear(result);
+
+    if (!prepared) {
+        return nullptr;
+    }
+
+    preparedLru.push_front(query);
+    PreparedStatement& statement = preparedStatements[query];
+    statement.name = name;
+    if (paramTypes) {
+        statement.paramTypes.assign(paramTypes, paramTypes + paramCount);
+    }
+    statement.lruPosition = preparedLru.begin();
+
+    evictPreparedStatements();
+    return &preparedStatements[query];
+}
+
+void DatabaseConnection::forgetPreparedStatement(const std::string& query) {
+    auto it = preparedStatements.find(query);
+    if (it != preparedStatements.end()) {
+        preparedLru.erase(it->second.lruPosition);
+        preparedStatements.erase(it);
+    }
+}
+
+void DatabaseConnection::evictPreparedStatements() {
+    if (evictionDeferred) {
+        return;
+    }
+    while (preparedStatements.size() > statementCacheCapacity) {
+        const std::string& oldest = preparedLru.back();
+        auto it = preparedStatements.find(oldest);
+        pendingDeallocations.push_back(it->second.name);
+        preparedStatements.erase(it);
+        preparedLru.pop_back();
+    }
+}
+
+void DatabaseConnection::deallocatePendingStatements() {
+    // DEALLOCATE is rejected inside an aborted transaction, so evicted
+    // statements wait until the connection is usable again.
+    if (pendingDeallocations.empty() || !isConnected() ||
+        PQtransactionStatus(connection) == PQTRANS_INERROR) {
+        return;
+    }
+
+    for (const auto& name : pendingDeallocations) {
+        PGresult* result = PQexec(connection, ("DEALLOCATE " + name).c_str());
+        PQclear(result);
+    }
+    pendingDeallocations.clear();
+}
+
+void DatabaseConnection::reprepareStatements() {
+    pendingDeallocations.clear();
+
+    auto it = preparedLru.begin();
+    while (it != preparedLru.end()) {
+        const PreparedStatement& statement = preparedStatements[*it];
+        PGresult* result = PQprepare(connection, statement.name.c_str(), it->c_str(),
+                                     static_cast<int>(statement.paramTypes.size()),
+                                     statement.paramTypes.empty() ? nullptr : statement.paramTypes.data());
+        bool prepared = PQresultStatus(result) == PGRES_COMMAND_OK;
+        PQclear(result);
+
+        if (prepared) {
+            ++it;
+        } else {
+            preparedStatements.erase(*it);
+            it = preparedLru.erase(it);
+        }
+    }
+}
+
+bool DatabaseConnection::listen(const std::string& channel) {
+    if (!ensureConnected()) {
+        return false;
+    }
+
+    char* identifier = PQescapeIdentifier(connection, channel.c_str(), channel.size());
+    if (!identifier) {
+        std::cerr << "Invalid channel name: " << PQerrorMessage(connection) << std::endl;
+        return false;
+    }
+    bool listening = executeNonQuery(std::string("LISTEN ") + identifier);
+    PQfreemem(identifier);
+
+    if (listening && std::find(listenChannels.begin(), listenChannels.end(), channel) == listenChannels.end()) {
+        listenChannels.push_back(channel);
+    }
+    return listening;
+}
+
+bool DatabaseConnection::unlisten(const std::string& channel) {
+    listenChannels.erase(std::remove(listenChannels.begin(), listenChannels.end(), channel), listenChannels.end());
+    if (!isConnected()) {
+        return true;
+    }
+
+    char* identifier = PQescapeIdentifier(connection, channel.c_str(), channel.size());
+    if (!identifier) {
+        return false;
+    }
+    bool done = executeNonQuery(std::string("UNLISTEN ") + identifier);
+    PQfreemem(identifier);
+    return done;
+}
+
+bool DatabaseConnection::pollNotifications(int timeoutMs, const NotificationHandler& handler) {
+    if (!isConnected()) {
+        return false;
+    }
+
+    // Notifications can already be queued from earlier statements.
+    if (!PQconsumeInput(connection)) {
+        std::cerr << "Notification poll failed: " << PQerrorMessage(connection) << std::endl;
+        return false;
+    }
+
+    PGnotify* notification = PQnotifies(connection);
+    if (!notification) {
+        struct pollfd fd;
+        fd.fd = PQsocket(connection);
+        fd.events = POLLIN;
+        fd.revents = 0;
+
+        int ready = poll(&fd, 1, timeoutMs);
+        if (ready < 0) {
+            return errno == EINTR;
+        }
+        if (ready > 0 && !PQconsumeInput(connection)) {
+            std::cerr << "Notification poll failed: " << PQerrorMessage(connection) << std::endl;
+            return false;
+        }
+        notification = PQnotifies(connection);
+    }
+
+    while (notification) {
+        handler(notification->relname, notification->extra, notification->be_pid);
+        PQfreemem(notification);
+        notification = PQnotifies(connection);
+    }
+    return isConnected();
+}
+
+void DatabaseConnection::relistenChannels() {
+    for (const auto& channel : listenChannels) {
+        char* identifier = PQescapeIdentifier(connection, channel.c_str(), channel.size());
+        if (!identifier) {
+            continue;
+        }
+        PGresult* result = PQexec(connection, (std::string("LISTEN ") + identifier).c_str());
+        if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+            std::cerr << "Failed to re-listen on " << channel << ": " << PQerrorMessage(connection) << std::endl;
+        }
+        PQclear(result);
+        PQfreemem(identifier);
+    }
+}
+
+DatabaseConnection::Batch::Batch(DatabaseConnection& connection)
+    : connection(connection) {}
+
+DatabaseConnection::Batch::~Batch() {
+    clearResults();
+}
+
+size_t DatabaseConnection::Batch::add(const std::string& query, const std::vector<std::string>& params) {
+    statements.push_back({query, params});
+    return statements.size() - 1;
+}
+
+size_t DatabaseConnection::Batch::size() const {
+    return statements.size();
+}
+
+bool DatabaseConnection::Batch::empty() const {
+    return statements.empty();
+}
+
+void DatabaseConnection::Batch::clear() {
+    statements.clear();
+    clearResults();
+}
+
+void DatabaseConnection::Batch::clearResults() {
+    for (PGresult* result : results) {
+        if (result) {
+            PQclear(result);
+        }
+    }
+    results.clear();
+}
+
+bool DatabaseConnection::Batch::execute() {
+    clearResults();
+    results.resize(statements.size(), nullptr);
+
+    if (statements.empty()) {
+        return true;
+    }
+
+    if (!connection.ensureConnected()) {
+        return false;
+    }
+
+    if (!connection.asyncPending.empty()) {
+        connection.waitForAsync();
+    }
+
+    PGconn* conn = connection.connection;
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+
+    // Statements cannot be prepared synchronously inside a pipeline, so make
+    // sure every distinct query is in the statement cache before entering it.
+    // Eviction waits until the pipeline is done: with more distinct queries
+    // than the cache holds, preparing a later one would otherwise deallocate
+    // an earlier one before it is sent.
+    std::vector<std::string> statementNames;
+    statementNames.reserve(statements.size());
+    connection.evictionDeferred = true;
+    for (const auto& statement : statements) {
+        const PreparedStatement* prepared = connection.prepareStatement(statement.query);
+        statementNames.push_back(prepared ? prepared->name : "");
+    }
+
+    if (PQenterPipelineMode(conn) != 1) {
+        std::cerr << "Failed to enter pipeline mode: " << PQerrorMessage(conn) << std::endl;
+        connection.evictionDeferred = false;
+        connection.evictPreparedStatements();
+        return false;
+    }
+    PQsetnonblocking(conn, 1);
+
+    size_t sent = 0;
+    for (size_t i = 0; i < statements.size(); i++) {
+        std::vector<const char*> paramValues;
+        for (const auto& param : statements[i].params) {
+            paramValues.push_back(param.c_str());
+        }
+
+        int ok = statementNames[i].empty()
+            ? PQsendQueryParams(conn, statements[i].query.c_str(), paramValues.size(),
+                                nullptr, paramValues.data(), nullptr, nullptr, connection.resultFormat)
+            : PQsendQueryPrepared(conn, statementNames[i].c_str(), paramValues.size(),
+                                  paramValues.data(), nullptr, nullptr, connection.resultFormat);
+        if (!ok) {
+            std::cerr << "Failed to queue batch statement " << i << ": " << PQerrorMessage(conn) << std::endl;
+            break;
+        }
+        sent++;
+    }
+
+    bool success = PQpipelineSync(conn) == 1 && flushPipeline(conn);
+    PQsetnonblocking(conn, 0);
+
+    if (success) {
+        for (size_t i = 0; i < sent; i++) {
+            results[i] = PQgetResult(conn);
+            PGresult* trailing;
+            while ((trailing = PQgetResult(conn)) != nullptr) {
+                PQclear(trailing);
+            }
+        }
+
+        PGresult* sync = PQgetResult(conn);
+        success = sync && PQresultStatus(sync) == PGRES_PIPELINE_SYNC;
+        if (sync) {
+            PQclear(sync);
+        }
+    }
+
+    if (PQexitPipelineMode(conn) != 1) {
+        // A pipeline whose sync never went out still has uncollected
+        // results. Drop the connection rather than leave it stuck in
+        // pipeline mode: the pool discards it, and a standalone connection
+        // reconnects on its next call.
+        std::cerr << "Failed to exit pipeline mode: " << PQerrorMessage(conn) << std::endl;
+        connection.closeConnection();
+        success = false;
+    }
+    connection.evictionDeferred = false;
+    connection.evictPreparedStatements();
+
+    if (sent < statements.size()) {
+        success = false;
+    }
+
+    // The whole batch is one round trip, so its time is split evenly.
+    std::chrono::microseconds share(0);
+    if (sent > 0) {
+        share = std::chrono::microseconds(elapsedSince(started).count() / static_cast<long>(sent));
+    }
+    for (size_t i = 0; i < sent; i++) {
+        connection.recordStatement(statements[i].query, share, results[i], !succeeded(i));
+    }
+
+    for (size_t i = 0; i < sent; i++) {
+        if (!succeeded(i)) {
+            if (PQresultStatus(results[i]) != PGRES_PIPELINE_ABORTED) {
+                std::cerr << "Batch statement " << i << " failed: " << getError(i) << std::endl;
+            }
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+bool DatabaseConnection::Batch::flushPipeline(PGconn* conn) {
+    // Keep reading while we write so a large batch cannot deadlock with the
+    // server blocking on a full output buffer.
+    int pending;
+    while ((pending = PQflush(conn)) == 1) {
+        struct pollfd fd;
+        fd.fd = PQsocket(conn);
+        fd.events = POLLIN | POLLOUT;
+        fd.revents = 0;
+
+        if (poll(&fd, 1, -1) < 0) {
+            return false;
+        }
+        if ((fd.revents & POLLIN) && !PQconsumeInput(conn)) {
+            return false;
+        }
+    }
+    return pending == 0;
+}
+
+bool DatabaseConnection::Batch::succeeded(size_t index) const {
+    if (index >= results.size() || !results[index]) {
+        return false;
+    }
+    ExecStatusType status = PQresultStatus(results[index]);
+    return status == PGRES_TUPLES_OK || status == PGRES_COMMAND_OK;
+}
+
+PGresult* DatabaseConnection::Batch::takeResult(size_t index) {
+    if (index >= results.size() || !succeeded(index)) {
+        return nullptr;
+    }
+    PGresult* result = results[index];
+    results[index] = nullptr;
+    return result;
+}
+
+std::string DatabaseConnection::Batch::getError(size_t index) const {
+    if (index >= results.size() || !results[index]) {
+        return "Statement was not executed";
+    }
+    if (PQresultStatus(results[index]) == PGRES_PIPELINE_ABORTED) {
+        return "Statement skipped after an earlier error in the batch";
+    }
+    return std::string(PQresultErrorMessage(results[index]));
+}
+
+std::shared_ptr<DatabaseConnection> DatabaseConnection::getInstance() {
+    if (!instance) {
+        instance = std::make_shared<DatabaseConnection>();
+    }
+    return instance;
+}
+
+void DatabaseConnection::setInstance(std::shared_ptr<DatabaseConnection> instance) {
+    DatabaseConnection::instance = instance;
+}
+
+namespace {
+
+// Type OIDs from pg_type; stable across PostgreSQL versions.
+const Oid BOOL_OID = 16;
+const Oid INT8_OID = 20;
+const Oid INT2_OID = 21;
+const Oid INT4_OID = 23;
+const Oid FLOAT4_OID = 700;
+const Oid FLOAT8_OID = 701;
+const Oid DATE_OID = 1082;
+const Oid TIMESTAMP_OID = 1114;
+const Oid TIMESTAMPTZ_OID = 1184;
+const Oid NUMERIC_OID = 1700;
+
+// Binary values are big-endian; PostgreSQL dates and timestamps count from 2000-01-01.
+const long long POSTGRES_EPOCH_DAYS = 10957;
+const long long USECS_PER_DAY = 86400000000LL;
+
+uint64_t readUInt64(const char* data) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+uint32_t readUInt32(const char* data) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    return (static_cast<uint32_t>(bytes[0]) << 24) | (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) | static_cast<uint32_t>(bytes[3]);
+}
+
+int16_t readInt16(const char* data) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    return static_cast<int16_t>((bytes[0] << 8) | bytes[1]);
+}
+
+int32_t readInt32(const char* data) {
+    return static_cast<int32_t>(readUInt32(data));
+}
+
+int64_t readInt64(const char* data) {
+    return static_cast<int64_t>(readUInt64(data));
+}
+
+float readFloat4(const char* data) {
+    uint32_t bits = readUInt32(data);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+double readFloat8(const char* data) {
+    uint64_t bits = readUInt64(data);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::string formatFloat(double value, int maxPrecision) {
+    char buffer[32];
+    for (int precision = 6; precision <= maxPrecision; precision++) {
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+        if (std::strtod(buffer, nullptr) == value) {
+            break;
+        }
+    }
+    return buffer;
+}
+
+void appendUInt16(std::string& out, uint16_t value) {
+    out += static_cast<char>((value >> 8) & 0xFF);
+    out += static_cast<char>(value & 0xFF);
+}
+
+void appendUInt32(std::string& out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out += static_cast<char>((value >> shift) & 0xFF);
+    }
+}
+
+void appendUInt64(std::string& out, uint64_t value) {
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        out += static_cast<char>((value >> shift) & 0xFF);
+    }
+}
+
+void writeUInt16(std::string& out, size_t offset, uint16_t value) {
+    out[offset] = static_cast<char>((value >> 8) & 0xFF);
+    out[offset + 1] = static_cast<char>(value & 0xFF);
+}
+
+long long daysFromCivil(int year, int month, int day) {
+    year -= month <= 2 ? 1 : 0;
+    long long era = (year >= 0 ? year : year - 399) / 400;
+    long long yearOfEra = year - era * 400;
+    long long dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    long long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+void civilFromDays(long long days, int& year, int& month, int& day) {
+    days += 719468;
+    long long era = (days >= 0 ? days : days - 146096) / 146097;
+    long long dayOfEra = days - era * 146097;
+    long long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    long long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    long long monthPrime = (5 * dayOfYear + 2) / 153;
+    day = static_cast<int>(dayOfYear - (153 * monthPrime + 2) / 5 + 1);
+    month = static_cast<int>(monthPrime < 10 ? monthPrime + 3 : monthPrime - 9);
+    year = static_cast<int>(yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+}
+
+std::string formatDate(int32_t pgDays) {
+    if (pgDays == INT32_MAX) {
+        return "infinity";
+    }
+    if (pgDays == INT32_MIN) {
+        return "-infinity";
+    }
+
+    int year, month, day;
+    civilFromDays(pgDays + POSTGRES_EPOCH_DAYS, year, month, day);
+
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", year, month, day);
+    return buffer;
+}
+
+std::string formatTimestamp(int64_t pgMicros, bool withTimeZone) {
+    if (pgMicros == INT64_MAX) {
+        return "infinity";
+    }
+    if (pgMicros == INT64_MIN) {
+        return "-infinity";
+    }
+
+    long long days = pgMicros / USECS_PER_DAY;
+    long long micros = pgMicros % USECS_PER_DAY;
+    if (micros < 0) {
+        micros += USECS_PER_DAY;
+        days--;
+    }
+
+    int year, month, day;
+    civilFromDays(days + POSTGRES_EPOCH_DAYS, year, month, day);
+
+    long long seconds = micros / 1000000;
+    long long fraction = micros % 1000000;
+
+    char buffer[48];
+    int length = std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02lld:%02lld:%02lld",
+                               year, month, day, seconds / 3600, (seconds / 60) % 60, seconds % 60);
+    std::string text(buffer, length);
+
+    if (fraction != 0) {
+        std::snprintf(buffer, sizeof(buffer), ".%06lld", fraction);
+        std::string fractionText(buffer);
+        fractionText.erase(fractionText.find_last_not_of('0') + 1);
+        text += fractionText;
+    }
+
+    if (withTimeZone) {
+        text += "+00";
+    }
+    return text;
+}
+
+// Binary numeric: ndigits, weight, sign, dscale (all int16), then ndigits
+// base-10000 digits, the first of which is scaled by 10000^weight.
+const uint16_t NUMERIC_NEG = 0x4000;
+const uint16_t NUMERIC_NAN = 0xC000;
+const uint16_t NUMERIC_PINF = 0xD000;
+const uint16_t NUMERIC_NINF = 0xF000;
+
+double numericToDouble(const char* data, int length) {
+    if (length < 8) {
+        return 0.0;
+    }
+
+    int ndigits = readInt16(data);
+    int weight = readInt16(data + 2);
+    uint16_t sign = static_cast<uint16_t>(readInt16(data + 4));
+
+    if (sign == NUMERIC_NAN) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (sign == NUMERIC_PINF) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (sign == NUMERIC_NINF) {
+        return -std::numeric_limits<double>::infinity();
+    }
+
+    double value = 0.0;
+    for (int i = 0; i < ndigits && 8 + 2 * i + 1 < length; i++) {
+        value += readInt16(data + 8 + 2 * i) * std::pow(10000.0, weight - i);
+    }
+    return sign == NUMERIC_NEG ? -value : value;
+}
+
+std::string numericToString(const char* data, int length) {
+    if (length < 8) {
+        return "";
+    }
+
+    int ndigits = readInt16(data);
+    int weight = readInt16(data + 2);
+    uint16_t sign = static_cast<uint16_t>(readInt16(data + 4));
+    int dscale = readInt16(data + 6);
+
+    if (sign == NUMERIC_NAN) {
+        return "NaN";
+    }
+    if (sign == NUMERIC_PINF) {
+        return "Infinity";
+    }
+    if (sign == NUMERIC_NINF) {
+        return "-Infinity";
+    }
+
+    auto digitAt = [data, ndigits, length](int i) -> int {
+        if (i < 0 || i >= ndigits || 8 + 2 * i + 1 >= length) {
+            return 0;
+        }
+        return readInt16(data + 8 + 2 * i);
+    };
+
+    std::string text;
+    if (sign == NUMERIC_NEG) {
+        text += '-';
+    }
+
+    char group[8];
+    if (weight < 0) {
+        text += '0';
+    } else {
+        for (int i = 0; i <= weight; i++) {
+            std::snprintf(group, sizeof(group), i == 0 ? "%d" : "%04d", digitAt(i));
+            text += group;
+        }
+    }
+
+    if (dscale > 0) {
+        std::string fraction;
+        for (int i = weight + 1; static_cast<int>(fraction.size()) < dscale; i++) {
+            std::snprintf(group, sizeof(group), "%04d", digitAt(i));
+            fraction += group;
+        }
+        text += '.';
+        text += fraction.substr(0, dscale);
+    }
+
+    return text;
+}
+
+// Decode one non-NULL value of either wire format. Text values are parsed;
+// binary values are decoded according to the column's type.
+long long decodeInt64(const char* value, int length, bool binary, Oid type) {
+    if (binary) {
+        switch (type) {
+            case INT2_OID: return readInt16(value);
+            case INT4_OID: return readInt32(value);
+            case INT8_OID: return readInt64(value);
+            case BOOL_OID: return value[0] != 0;
+            case DATE_OID: return readInt32(value);
+            case FLOAT4_OID: return static_cast<long long>(readFloat4(value));
+            case FLOAT8_OID: return static_cast<long long>(readFloat8(value));
+            case NUMERIC_OID: return static_cast<long long>(numericToDouble(value, length));
+            default: break;
+        }
+    }
+    return std::strtoll(value, nullptr, 10);
+}
+
+double decodeDouble(const char* value, int length, bool binary, Oid type) {
+    if (binary) {
+        switch (type) {
+            case INT2_OID: return readInt16(value);
+            case INT4_OID: return readInt32(value);
+            case INT8_OID: return static_cast<double>(readInt64(value));
+            case FLOAT4_OID: return readFloat4(value);
+            case FLOAT8_OID: return readFloat8(value);
+            case NUMERIC_OID: return numericToDouble(value, length);
+            default: break;
+        }
+    }
+    return std::strtod(value, nullptr);
+}
+
+bool decodeBool(const char* value, bool binary, Oid type) {
+    if (binary && type == BOOL_OID) {
+        return value[0] != 0;
+    }
+    return std::strcmp(value, "t") == 0 || std::strcmp(value, "true") == 0 || std::strcmp(value, "1") == 0;
+}
+
+// Binary COPY framing: signature, flags and header-extension length.
+const char COPY_BINARY_SIGNATURE[] = "PGCOPY\n\377\r\n";
+const size_t COPY_BINARY_SIGNATURE_LENGTH = 11;
+
+// Quotes an identifier for SQL text; a qualified name is split on its dots.
+bool quoteIdentifier(PGconn* conn, const std::string& name, bool qualified, std::string& quoted) {
+    quoted.clear();
+    size_t start = 0;
+    while (true) {
+        size_t end = qualified ? name.find('.', start) : std::string::npos;
+        std::string part = name.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        char* escaped = PQescapeIdentifier(conn, part.c_str(), part.size());
+        if (!escaped) {
+            return false;
+        }
+        quoted += escaped;
+        PQfreemem(escaped);
+        if (end == std::string::npos) {
+            return true;
+        }
+        quoted += '.';
+        start = end + 1;
+    }
+}
+
+}
+
+DatabaseConnection::CopyWriter::CopyWriter(DatabaseConnection& connection, Format format, size_t flushThreshold)
+    : connection(connection), format(format), flushThreshold(flushThreshold), rowStart(0),
+      fieldsInRow(0), expectedFields(-1), rowsWritten(0), bytesSent(0), active(false) {}
+
+DatabaseConnection::CopyWriter::~CopyWriter() {
+    if (active) {
+        abort("CopyWriter destroyed before finish()");
+    }
+}
+
+bool DatabaseConnection::CopyWriter::begin(const std::string& table, const std::vector<std::string>& columns) {
+    if (active) {
+        fail("COPY already in progress");
+        return false;
+    }
+
+    error.clear();
+    buffer.clear();
+    fieldsInRow = 0;
+    rowsWritten = 0;
+    bytesSent = 0;
+    started = std::chrono::steady_clock::now();
+    expectedFields = columns.empty() ? -1 : static_cast<int>(columns.size());
+
+    if (!connection.ensureConnected()) {
+        fail("Database not connected");
+        return false;
+    }
+
+    if (!connection.asyncPending.empty()) {
+        connection.waitForAsync();
+    }
+
+    std::ostringstream query;
+    query << "COPY ";
+    std::string name;
+    if (!quoteIdentifier(connection.connection, table, true, name)) {
+        fail("Invalid table name: " + table);
+        return false;
+    }
+    query << name;
+    if (!columns.empty()) {
+        query << " (";
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (!quoteIdentifier(connection.connection, columns[i], false, name)) {
+                fail("Invalid column name: " + columns[i]);
+                return false;
+            }
+            query << (i > 0 ? ", " : "") << name;
+        }
+        query << ")";
+    }
+    query << " FROM STDIN" << (format == BINARY ? " WITH (FORMAT binary)" : "");
+
+    copyQuery = query.str();
+    PGresult* result = PQexec(connection.connection, copyQuery.c_str());
+    bool copying = PQresultStatus(result) == PGRES_COPY_IN;
+    if (!copying) {
+        fail(PQresultErrorMessage(result));
+        connection.recordStatement(copyQuery, elapsedSince(started), nullptr, true);
+    }
+    PQclear(result);
+    if (!copying) {
+        return false;
+    }
+
+    active = true;
+    if (format == BINARY) {
+        buffer.append(COPY_BINARY_SIGNATURE, COPY_BINARY_SIGNATURE_LENGTH);
+        appendUInt32(buffer, 0);
+        appendUInt32(buffer, 0);
+    }
+    rowStart = buffer.size();
+    return true;
+}
+
+void DatabaseConnection::CopyWriter::beginField() {
+    if (format == BINARY) {
+        if (fieldsInRow == 0) {
+            // Field count is patched in by endRow().
+            appendUInt16(buffer, 0);
+        }
+    } else if (fieldsInRow > 0) {
+        buffer += '\t';
+    }
+    fieldsInRow++;
+}
+
+void DatabaseConnection::CopyWriter::addField(const std::string& value) {
+    addField(value.data(), value.size());
+}
+
+void DatabaseConnection::CopyWriter::addField(const char* value, size_t length) {
+    beginField();
+    if (format == BINARY) {
+        appendUInt32(buffer, static_cast<uint32_t>(length));
+        buffer.append(value, length);
+        return;
     }
 
-    connected = true;
-    return true;
+    for (size_t i = 0; i < length; i++) {
+        switch (value[i]) {
+            case '\\': buffer += "\\\\"; break;
+            case '\t': buffer += "\\t"; break;
+            case '\n': buffer += "\\n"; break;
+            case '\r': buffer += "\\r"; break;
+            default: buffer += value[i];
+        }
+    }
 }
 
-bool DatabaseConnection::connect(const std::string& host, const std::string& port,
-                               const std::string& dbname, const std::string& user,
-                               const std::string& password) {
-    buildConnectionString(host, port, dbname, user, password);
-    return connect();
+void DatabaseConnection::CopyWriter::addNull() {
+    beginField();
+    if (format == BINARY) {
+        appendUInt32(buffer, 0xFFFFFFFF);
+    } else {
+        buffer += "\\N";
+    }
 }
 
-void DatabaseConnection::disconnect() {
-    if (connection) {
-        PQfinish(connection);
-        connection = nullptr;
-        connected = false;
+void DatabaseConnection::CopyWriter::addInt(int value) {
+    if (format == TEXT) {
+        addField(std::to_string(value));
+        return;
     }
+    beginField();
+    appendUInt32(buffer, 4);
+    appendUInt32(buffer, static_cast<uint32_t>(value));
 }
 
-bool DatabaseConnection::isConnected() const {
-    return connected && connection && PQstatus(connection) == CONNECTION_OK;
+void DatabaseConnection::CopyWriter::addInt64(long long value) {
+    if (format == TEXT) {
+        addField(std::to_string(value));
+        return;
+    }
+    beginField();
+    appendUInt32(buffer, 8);
+    appendUInt64(buffer, static_cast<uint64_t>(value));
 }
 
-PGresult* DatabaseConnection::executeQuery(const std::string& query) {
-    if (!isConnected()) {
-        std::cerr << "Database not connected" << std::endl;
-        return nullptr;
+void DatabaseConnection::CopyWriter::addDouble(double value) {
+    if (format == TEXT) {
+        addField(formatFloat(value, 17));
+        return;
     }
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    beginField();
+    appendUInt32(buffer, 8);
+    appendUInt64(buffer, bits);
+}
 
-    PGresult* result = PQexec(connection, query.c_str());
+void DatabaseConnection::CopyWriter::addBool(bool value) {
+    if (format == TEXT) {
+        addField(value ? "t" : "f", 1);
+        return;
+    }
+    beginField();
+    appendUInt32(buffer, 1);
+    buffer += static_cast<char>(value ? 1 : 0);
+}
 
-    if (PQresultStatus(result) != PGRES_TUPLES_OK && PQresultStatus(result) != PGRES_COMMAND_OK) {
-        std::cerr << "Query execution failed: " << PQerrorMessage(connection) << std::endl;
-        PQclear(result);
-        return nullptr;
+void DatabaseConnection::CopyWriter::addDate(const std::string& isoDate) {
+    if (format == TEXT) {
+        addField(isoDate);
+        return;
     }
 
-    return result;
+    int year, month, day;
+    if (std::sscanf(isoDate.c_str(), "%d-%d-%d", &year, &month, &day) != 3) {
+        fail("Invalid date for binary COPY: " + isoDate);
+        addNull();
+        return;
+    }
+    beginField();
+    appendUInt32(buffer, 4);
+    appendUInt32(buffer, static_cast<uint32_t>(daysFromCivil(year, month, day) - POSTGRES_EPOCH_DAYS));
 }
 
-PGresult* DatabaseConnection::executeParameterizedQuery(const std::string& query,
-                                                       const std::vector<std::string>& params) {
-    if (!isConnected()) {
-        std::cerr << "Database not connected" << std::endl;
-        return nullptr;
+bool DatabaseConnection::CopyWriter::endRow() {
+    if (!active) {
+        fail("COPY not in progress");
+        return false;
     }
 
-    std::vector<const char*> paramValues;
-    for (const auto& param : params) {
-        paramValues.push_back(param.c_str());
+    if (expectedFields >= 0 && fieldsInRow != expectedFields) {
+        std::ostringstream message;
+        message << "Row " << rowsWritten + 1 << " has " << fieldsInRow
+                << " fields, expected " << expectedFields;
+        fail(message.str());
+        buffer.resize(rowStart);
+        fieldsInRow = 0;
+        return false;
+    }
+
+    if (format == BINARY) {
+        if (fieldsInRow == 0) {
+            appendUInt16(buffer, 0);
+        }
+        writeUInt16(buffer, rowStart, static_cast<uint16_t>(fieldsInRow));
+    } else {
+        buffer += '\n';
     }
 
-    PGresult* result = PQexecParams(connection, query.c_str(), params.size(),
-                                   nullptr, paramValues.data(), nullptr, nullptr, 0);
+    fieldsInRow = 0;
+    rowsWritten++;
+    rowStart = buffer.size();
 
-    if (PQresultStatus(result) != PGRES_TUPLES_OK && PQresultStatus(result) != PGRES_COMMAND_OK) {
-        std::cerr << "Parameterized query execution failed: " << PQerrorMessage(connection) << std::endl;
-        PQclear(result);
-        return nullptr;
+    if (buffer.size() >= flushThreshold) {
+        return flush();
     }
+    return true;
+}
 
-    return result;
+bool DatabaseConnection::CopyWriter::writeRow(const std::vector<std::string>& values) {
+    for (const auto& value : values) {
+        addField(value);
+    }
+    return endRow();
 }
 
-bool DatabaseConnection::executeNonQuery(const std::string& query) {
-    PGresult* result = executeQuery(query);
-    if (result) {
-        PQclear(result);
+bool DatabaseConnection::CopyWriter::flush() {
+    if (buffer.empty()) {
         return true;
     }
-    return false;
+
+    if (PQputCopyData(connection.connection, buffer.data(), static_cast<int>(buffer.size())) != 1) {
+        fail(PQerrorMessage(connection.connection));
+        return false;
+    }
+    bytesSent += buffer.size();
+    buffer.clear();
+    rowStart = 0;
+    return true;
 }
 
-bool DatabaseConnection::executeParameterizedNonQuery(const std::string& query,
-                                                     const std::vector<std::string>& params) {
-    PGresult* result = executeParameterizedQuery(query, params);
-    if (result) {
+bool DatabaseConnection::CopyWriter::finish() {
+    if (!active) {
+        fail("COPY not in progress");
+        return false;
+    }
+
+    if (fieldsInRow > 0) {
+        buffer.resize(rowStart);
+        fieldsInRow = 0;
+        std::cerr << "COPY finished with an incomplete row; it was discarded" << std::endl;
+    }
+    if (format == BINARY) {
+        appendUInt16(buffer, 0xFFFF);
+    }
+
+    // A partial load is never committed: if any row failed locally, abort
+    // the whole COPY so the server rolls it back.
+    bool success = error.empty() && flush();
+    const char* abortMessage = success ? nullptr : "COPY aborted after client-side error";
+    if (PQputCopyEnd(connection.connection, abortMessage) != 1) {
+        fail(PQerrorMessage(connection.connection));
+        success = false;
+    }
+    active = false;
+
+    PGresult* result;
+    while ((result = PQgetResult(connection.connection)) != nullptr) {
+        if (PQresultStatus(result) == PGRES_COMMAND_OK) {
+            const char* tuples = PQcmdTuples(result);
+            if (tuples && *tuples) {
+                rowsWritten = std::strtoll(tuples, nullptr, 10);
+            }
+        } else {
+            if (error.empty()) {
+                fail(PQresultErrorMessage(result));
+            }
+            success = false;
+        }
         PQclear(result);
-        return true;
     }
-    return false;
+
+    buffer.clear();
+    connection.recordStatement(copyQuery, elapsedSince(started), static_cast<unsigned long long>(rowsWritten),
+                               bytesSent, !success);
+    return success;
 }
 
-std::string DatabaseConnection::escapeString(const std::string& input) {
-    if (!isConnected()) {
-        return input;
+void DatabaseConnection::CopyWriter::abort(const std::string& reason) {
+    if (!active) {
+        return;
     }
 
-    char* escaped = new char[input.length() * 2 + 1];
-    PQescapeStringConn(connection, escaped, input.c_str(), input.length(), nullptr);
-    std::string result(escaped);
-    delete[] escaped;
-    return result;
-}
+    active = false;
+    buffer.clear();
+    fieldsInRow = 0;
 
-std::string DatabaseConnection::getLastError() const {
-    if (connection) {
-        return std::string(PQerrorMessage(connection));
+    PQputCopyEnd(connection.connection, reason.c_str());
+    PGresult* result;
+    while ((result = PQgetResult(connection.connection)) != nullptr) {
+        PQclear(result);
     }
-    return "No connection";
 }
 
-bool DatabaseConnection::beginTransaction() {
-    return executeNonQuery("BEGIN");
+bool DatabaseConnection::CopyWriter::isActive() const {
+    return active;
 }
 
-bool DatabaseConnection::commitTransaction() {
-    return executeNonQuery("COMMIT");
+long long DatabaseConnection::CopyWriter::getRowCount() const {
+    return rowsWritten;
 }
 
-bool DatabaseConnection::rollbackTransaction() {
-    return executeNonQuery("ROLLBACK");
+std::string DatabaseConnection::CopyWriter::getError() const {
+    return error;
 }
 
-std::shared_ptr<DatabaseConnection> DatabaseConnection::getInstance() {
-    if (!instance) {
-        instance = std::make_shared<DatabaseConnection>();
+void DatabaseConnection::CopyWriter::fail(const std::string& message) {
+    if (error.empty()) {
+        error = message;
     }
-    return instance;
+    std::cerr << "COPY failed: " << message << std::endl;
 }
 
-void DatabaseConnection::setInstance(std::shared_ptr<DatabaseConnection> instance) {
-    DatabaseConnection::instance = instance;
+ResultColumns::ResultColumns(const PGresult* result) {
+    int count = result ? PQnfields(result) : 0;
+    names.reserve(count);
+    for (int i = 0; i < count; i++) {
+        names.emplace_back(PQfname(result, i));
+    }
+
+    // Keys view into `names`, which is never resized after this point.
+    // On duplicate names the first column wins, as with PQfnumber.
+    indexes.reserve(count);
+    for (int i = 0; i < count; i++) {
+        indexes.emplace(names[i], i);
+    }
+}
+
+int ResultColumns::size() const {
+    return static_cast<int>(names.size());
+}
+
+const std::string& ResultColumns::nameAt(int fieldIndex) const {
+    return names[fieldIndex];
+}
+
+int ResultColumns::indexOf(std::string_view name) const {
+    std::unordered_map<std::string_view, int>::const_iterator it = indexes.find(name);
+    return it == indexes.end() ? -1 : it->second;
 }
 
 DatabaseResult::DatabaseResult(PGresult* result)
@@ -176,6 +2048,43 @@ DatabaseResult::DatabaseResult(PGresult* result)
     }
 }
 
+DatabaseResult::DatabaseResult(PGresult* result, std::shared_ptr<const ResultColumns> columns)
+    : DatabaseResult(result) {
+    if (columns && columns->size() == numFields) {
+        this->columns = columns;
+    }
+}
+
+DatabaseResult::DatabaseResult(DatabaseResult&& other) noexcept
+    : result(other.result), currentRow(other.currentRow), numRows(other.numRows), numFields(other.numFields),
+      columns(std::move(other.columns)), convertedValues(std::move(other.convertedValues)),
+      rowSet(std::move(other.rowSet)) {
+    other.result = nullptr;
+    other.currentRow = -1;
+    other.numRows = 0;
+    other.numFields = 0;
+}
+
+DatabaseResult& DatabaseResult::operator=(DatabaseResult&& other) noexcept {
+    if (this != &other) {
+        if (result) {
+            PQclear(result);
+        }
+        result = other.result;
+        currentRow = other.currentRow;
+        numRows = other.numRows;
+        numFields = other.numFields;
+        columns = std::move(other.columns);
+        convertedValues = std::move(other.convertedValues);
+        rowSet = std::move(other.rowSet);
+        other.result = nullptr;
+        other.currentRow = -1;
+        other.numRows = 0;
+        other.numFields = 0;
+    }
+    return *this;
+}
+
 DatabaseResult::~DatabaseResult() {
     if (result) {
         PQclear(result);
@@ -207,66 +2116,145 @@ void DatabaseResult::reset() {
 }
 
 std::string DatabaseResult::getString(int fieldIndex) const {
-    if (!result || currentRow < 0 || currentRow >= numRows || fieldIndex < 0 || fieldIndex >= numFields) {
-        return "";
-    }
-
-    if (PQgetisnull(result, currentRow, fieldIndex)) {
-        return "";
-    }
-
-    return std::string(PQgetvalue(result, currentRow, fieldIndex));
+    return valueAsText(currentRow, fieldIndex);
 }
 
-std::string DatabaseResult::getString(const std::string& fieldName) const {
+std::string DatabaseResult::getString(std::string_view fieldName) const {
     int fieldIndex = getFieldIndex(fieldName);
     return getString(fieldIndex);
 }
 
 int DatabaseResult::getInt(int fieldIndex) const {
-    std::string value = getString(fieldIndex);
-    if (value.empty()) {
-        return 0;
-    }
-    try {
-        return std::stoi(value);
-    } catch (const std::exception&) {
+    return static_cast<int>(getInt64(fieldIndex));
+}
+
+int DatabaseResult::getInt(std::string_view fieldName) const {
+    int fieldIndex = getFieldIndex(fieldName);
+    return getInt(fieldIndex);
+}
+
+long long DatabaseResult::getInt64(int fieldIndex) const {
+    const char* value = rawValue(fieldIndex);
+    if (!value) {
         return 0;
     }
+    return decodeInt64(value, PQgetlength(result, currentRow, fieldIndex),
+                       PQfformat(result, fieldIndex) == 1, PQftype(result, fieldIndex));
 }
 
-int DatabaseResult::getInt(const std::string& fieldName) const {
+long long DatabaseResult::getInt64(std::string_view fieldName) const {
     int fieldIndex = getFieldIndex(fieldName);
-    return getInt(fieldIndex);
+    return getInt64(fieldIndex);
 }
 
 double DatabaseResult::getDouble(int fieldIndex) const {
-    std::string value = getString(fieldIndex);
-    if (value.empty()) {
-        return 0.0;
-    }
-    try {
-        return std::stod(value);
-    } catch (const std::exception&) {
+    const char* value = rawValue(fieldIndex);
+    if (!value) {
         return 0.0;
     }
+    return decodeDouble(value, PQgetlength(result, currentRow, fieldIndex),
+                        PQfformat(result, fieldIndex) == 1, PQftype(result, fieldIndex));
 }
 
-double DatabaseResult::getDouble(const std::string& fieldName) const {
+double DatabaseResult::getDouble(std::string_view fieldName) const {
     int fieldIndex = getFieldIndex(fieldName);
     return getDouble(fieldIndex);
 }
 
 bool DatabaseResult::getBool(int fieldIndex) const {
-    std::string value = getString(fieldIndex);
-    return value == "t" || value == "true" || value == "1";
+    const char* value = rawValue(fieldIndex);
+    if (!value) {
+        return false;
+    }
+    return decodeBool(value, PQfformat(result, fieldIndex) == 1, PQftype(result, fieldIndex));
 }
 
-bool DatabaseResult::getBool(const std::string& fieldName) const {
+bool DatabaseResult::getBool(std::string_view fieldName) const {
     int fieldIndex = getFieldIndex(fieldName);
     return getBool(fieldIndex);
 }
 
+const char* DatabaseResult::rawValue(int fieldIndex) const {
+    if (!result || currentRow < 0 || currentRow >= numRows || fieldIndex < 0 || fieldIndex >= numFields) {
+        return nullptr;
+    }
+
+    if (PQgetisnull(result, currentRow, fieldIndex)) {
+        return nullptr;
+    }
+
+    return PQgetvalue(result, currentRow, fieldIndex);
+}
+
+std::string DatabaseResult::valueAsText(int row, int fieldIndex) const {
+    if (!result || row < 0 || row >= numRows || fieldIndex < 0 || fieldIndex >= numFields) {
+        return "";
+    }
+
+    if (PQgetisnull(result, row, fieldIndex)) {
+        return "";
+    }
+
+    const char* value = PQgetvalue(result, row, fieldIndex);
+    int length = PQgetlength(result, row, fieldIndex);
+
+    if (PQfformat(result, fieldIndex) == 0) {
+        return std::string(value, length);
+    }
+
+    switch (PQftype(result, fieldIndex)) {
+        case INT2_OID: return std::to_string(readInt16(value));
+        case INT4_OID: return std::to_string(readInt32(value));
+        case INT8_OID: return std::to_string(readInt64(value));
+        case BOOL_OID: return value[0] ? "t" : "f";
+        case FLOAT4_OID: return formatFloat(readFloat4(value), 9);
+        case FLOAT8_OID: return formatFloat(readFloat8(value), 17);
+        case NUMERIC_OID: return numericToString(value, length);
+        case DATE_OID: return formatDate(readInt32(value));
+        case TIMESTAMP_OID: return formatTimestamp(readInt64(value), false);
+        case TIMESTAMPTZ_OID: return formatTimestamp(readInt64(value), true);
+        default: return std::string(value, length);
+    }
+}
+
+std::string_view DatabaseResult::getStringView(int fieldIndex) const {
+    const char* value = rawValue(fieldIndex);
+    if (!value) {
+        return std::string_view();
+    }
+
+    int length = PQgetlength(result, currentRow, fieldIndex);
+    if (PQfformat(result, fieldIndex) == 0) {
+        return std::string_view(value, length);
+    }
+
+    switch (PQftype(result, fieldIndex)) {
+        case INT2_OID:
+        case INT4_OID:
+        case INT8_OID:
+        case BOOL_OID:
+        case FLOAT4_OID:
+        case FLOAT8_OID:
+        case NUMERIC_OID:
+        case DATE_OID:
+        case TIMESTAMP_OID:
+        case TIMESTAMPTZ_OID:
+            if (convertedValues.empty()) {
+                convertedValues.resize(numFields);
+            }
+            convertedValues[fieldIndex] = valueAsText(currentRow, fieldIndex);
+            return convertedValues[fieldIndex];
+        default:
+            // Binary text types are sent as their raw bytes.
+            return std::string_view(value, length);
+    }
+}
+
+std::string_view DatabaseResult::getStringView(std::string_view fieldName) const {
+    int fieldIndex = getFieldIndex(fieldName);
+    return getStringView(fieldIndex);
+}
+
 bool DatabaseResult::isNull(int fieldIndex) const {
     if (!result || currentRow < 0 || currentRow >= numRows || fieldIndex < 0 || fieldIndex >= numFields) {
         return true;
@@ -274,7 +2262,7 @@ bool DatabaseResult::isNull(int fieldIndex) const {
     return PQgetisnull(result, currentRow, fieldIndex);
 }
 
-bool DatabaseResult::isNull(const std::string& fieldName) const {
+bool DatabaseResult::isNull(std::string_view fieldName) const {
     int fieldIndex = getFieldIndex(fieldName);
     return isNull(fieldIndex);
 }
@@ -286,57 +2274,234 @@ std::string DatabaseResult::getFieldName(int fieldIndex) const {
     return std::string(PQfname(result, fieldIndex));
 }
 
-int DatabaseResult::getFieldIndex(const std::string& fieldName) const {
+int DatabaseResult::getFieldIndex(std::string_view fieldName) const {
     if (!result) {
         return -1;
     }
+    return getColumns()->indexOf(fieldName);
+}
 
-    for (int i = 0; i < numFields; i++) {
-        if (getFieldName(i) == fieldName) {
-            return i;
-        }
+std::shared_ptr<const ResultColumns> DatabaseResult::getColumns() const {
+    if (!columns) {
+        columns = std::make_shared<ResultColumns>(result);
     }
-    return -1;
+    return columns;
 }
 
-std::vector<std::map<std::string, std::string>> DatabaseResult::getAllRows() const {
-    std::vector<std::map<std::string, std::string>> rows;
+template <typename T>
+TypedColumn<T> DatabaseResult::column(std::string_view fieldName) const {
+    return column<T>(getFieldIndex(fieldName));
+}
 
-    if (!result) {
-        return rows;
+template <typename T>
+TypedColumn<T> DatabaseResult::column(int fieldIndex) const {
+    TypedColumn<T> decoded;
+    if (!result || fieldIndex < 0 || fieldIndex >= numFields) {
+        return decoded;
     }
 
+    decoded.name = PQfname(result, fieldIndex);
+    decoded.data.resize(numRows);
+    decoded.validity.assign((numRows + 63) / 64, 0);
+
+    bool binary = PQfformat(result, fieldIndex) == 1;
+    Oid type = PQftype(result, fieldIndex);
+
     for (int row = 0; row < numRows; row++) {
-        std::map<std::string, std::string> rowData;
-        for (int field = 0; field < numFields; field++) {
-            std::string fieldName = getFieldName(field);
-            std::string value = "";
-            if (!PQgetisnull(result, row, field)) {
-                value = std::string(PQgetvalue(result, row, field));
-            }
-            rowData[fieldName] = value;
+        if (PQgetisnull(result, row, fieldIndex)) {
+            decoded.nullCount++;
+            continue;
+        }
+        decoded.validity[row / 64] |= uint64_t(1) << (row % 64);
+
+        const char* value = PQgetvalue(result, row, fieldIndex);
+        int length = PQgetlength(result, row, fieldIndex);
+        if constexpr (std::is_same<T, std::string>::value) {
+            decoded.data[row] = binary ? valueAsText(row, fieldIndex) : std::string(value, length);
+        } else if constexpr (std::is_floating_point<T>::value) {
+            decoded.data[row] = static_cast<T>(decodeDouble(value, length, binary, type));
+        } else {
+            decoded.data[row] = static_cast<T>(decodeInt64(value, length, binary, type));
         }
-        rows.push_back(rowData);
     }
 
-    return rows;
+    return decoded;
 }
 
-std::map<std::string, std::string> DatabaseResult::getCurrentRow() const {
-    std::map<std::string, std::string> rowData;
+template TypedColumn<int> DatabaseResult::column<int>(std::string_view) const;
+template TypedColumn<long long> DatabaseResult::column<long long>(std::string_view) const;
+template TypedColumn<double> DatabaseResult::column<double>(std::string_view) const;
+template TypedColumn<float> DatabaseResult::column<float>(std::string_view) const;
+template TypedColumn<std::string> DatabaseResult::column<std::string>(std::string_view) const;
+template TypedColumn<int> DatabaseResult::column<int>(int) const;
+template TypedColumn<long long> DatabaseResult::column<long long>(int) const;
+template TypedColumn<double> DatabaseResult::column<double>(int) const;
+template TypedColumn<float> DatabaseResult::column<float>(int) const;
+template TypedColumn<std::string> DatabaseResult::column<std::string>(int) const;
+
+RowSet DatabaseResult::getAllRows() const {
+    if (!result || rowSet.data) {
+        return rowSet;
+    }
+
+    rowSet = RowSet(copyRows(0, numRows));
+    return rowSet;
+}
 
+RowSet::Row DatabaseResult::getCurrentRow() const {
     if (!result || currentRow < 0 || currentRow >= numRows) {
-        return rowData;
+        return RowSet::Row();
+    }
+    if (rowSet.data) {
+        return rowSet[currentRow];
+    }
+    // Copy just this row; cursor-style callers never pay for the whole result.
+    return RowSet(copyRows(currentRow, 1))[0];
+}
+
+std::shared_ptr<const RowSet::Data> DatabaseResult::copyRows(int firstRow, int rowCount) const {
+    std::shared_ptr<RowSet::Data> data = std::make_shared<RowSet::Data>();
+    data->columns = getColumns();
+    data->rowCount = rowCount;
+    data->fieldCount = numFields;
+
+    size_t cells = static_cast<size_t>(rowCount) * numFields;
+    data->offsets.reserve(cells + 1);
+    data->nullBits.assign((cells + 63) / 64, 0);
+
+    // Text values are copied as-is, so size the buffer for them up front.
+    size_t textBytes = 0;
+    for (int row = firstRow; row < firstRow + rowCount; row++) {
+        for (int field = 0; field < numFields; field++) {
+            textBytes += PQgetlength(result, row, field);
+        }
     }
+    data->arena.reserve(textBytes);
 
-    for (int field = 0; field < numFields; field++) {
-        std::string fieldName = getFieldName(field);
-        std::string value = "";
-        if (!PQgetisnull(result, currentRow, field)) {
-            value = std::string(PQgetvalue(result, currentRow, field));
+    size_t cell = 0;
+    for (int row = firstRow; row < firstRow + rowCount; row++) {
+        for (int field = 0; field < numFields; field++, cell++) {
+            data->offsets.push_back(data->arena.size());
+            if (PQgetisnull(result, row, field)) {
+                data->nullBits[cell / 64] |= uint64_t(1) << (cell % 64);
+            } else if (PQfformat(result, field) == 0) {
+                data->arena.append(PQgetvalue(result, row, field), PQgetlength(result, row, field));
+            } else {
+                data->arena += valueAsText(row, field);
+            }
         }
-        rowData[fieldName] = value;
     }
+    data->offsets.push_back(data->arena.size());
+    return data;
+}
+
+bool RowSet::Data::isNull(int row, int fieldIndex) const {
+    size_t cell = static_cast<size_t>(row) * fieldCount + fieldIndex;
+    return (nullBits[cell / 64] >> (cell % 64)) & 1;
+}
+
+std::string_view RowSet::Data::value(int row, int fieldIndex) const {
+    size_t cell = static_cast<size_t>(row) * fieldCount + fieldIndex;
+    return std::string_view(arena.data() + offsets[cell], offsets[cell + 1] - offsets[cell]);
+}
+
+RowSet::RowSet() {}
+
+RowSet::RowSet(std::shared_ptr<const Data> data) : data(data) {}
+
+int RowSet::size() const {
+    return data ? data->rowCount : 0;
+}
+
+bool RowSet::empty() const {
+    return size() == 0;
+}
+
+int RowSet::getFieldCount() const {
+    return data ? data->fieldCount : 0;
+}
+
+std::string RowSet::getFieldName(int fieldIndex) const {
+    if (fieldIndex < 0 || fieldIndex >= getFieldCount()) {
+        return "";
+    }
+    return data->columns->nameAt(fieldIndex);
+}
+
+int RowSet::getFieldIndex(std::string_view fieldName) const {
+    return data ? data->columns->indexOf(fieldName) : -1;
+}
+
+RowSet::Row RowSet::operator[](int row) const {
+    if (row < 0 || row >= size()) {
+        return Row();
+    }
+    return Row(data, row);
+}
+
+RowSet::Column RowSet::column(int fieldIndex) const {
+    if (fieldIndex < 0 || fieldIndex >= getFieldCount()) {
+        return Column();
+    }
+    return Column(data, fieldIndex);
+}
+
+RowSet::Column RowSet::column(std::string_view fieldName) const {
+    return column(getFieldIndex(fieldName));
+}
+
+RowSet::Row::Row() : row(-1) {}
+
+RowSet::Row::Row(std::shared_ptr<const Data> data, int row) : data(data), row(row) {}
+
+int RowSet::Row::size() const {
+    return data ? data->fieldCount : 0;
+}
+
+bool RowSet::Row::isNull(int fieldIndex) const {
+    if (!data || fieldIndex < 0 || fieldIndex >= data->fieldCount) {
+        return true;
+    }
+    return data->isNull(row, fieldIndex);
+}
+
+bool RowSet::Row::isNull(std::string_view fieldName) const {
+    return isNull(data ? data->columns->indexOf(fieldName) : -1);
+}
 
-    return rowData;
+std::string_view RowSet::Row::operator[](int fieldIndex) const {
+    if (!data || fieldIndex < 0 || fieldIndex >= data->fieldCount) {
+        return std::string_view();
+    }
+    return data->value(row, fieldIndex);
+}
+
+std::string_view RowSet::Row::operator[](std::string_view fieldName) const {
+    return (*this)[data ? data->columns->indexOf(fieldName) : -1];
+}
+
+RowSet::Column::Column() : fieldIndex(-1) {}
+
+RowSet::Column::Column(std::shared_ptr<const Data> data, int fieldIndex) : data(data), fieldIndex(fieldIndex) {}
+
+int RowSet::Column::size() const {
+    return data ? data->rowCount : 0;
+}
+
+std::string RowSet::Column::getName() const {
+    return data ? data->columns->nameAt(fieldIndex) : "";
+}
+
+bool RowSet::Column::isNull(int row) const {
+    if (!data || row < 0 || row >= data->rowCount) {
+        return true;
+    }
+    return data->isNull(row, fieldIndex);
+}
+
+std::string_view RowSet::Column::operator[](int row) const {
+    if (!data || row < 0 || row >= data->rowCount) {
+        return std::string_view();
+    }
+    return data->value(row, fieldIndex);
 }
\ No newline at end of file
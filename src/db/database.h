@@ -2,18 +2,278 @@
 #define DATABASE_H
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <vector>
 #include <map>
+#include <list>
+#include <deque>
+#include <functional>
+#include <future>
+#include <unordered_map>
+#include <unordered_set>
+#include <iosfwd>
+#include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
 #include <libpq-fe.h>
+#include "queryStatistics.h"
+#include "queryCache.h"
+
+class DatabaseResult;
+
+// Stack storage for DatabaseConnection::execute(). Strings are borrowed from
+// the caller; numbers are encoded into eight bytes of scratch per argument.
+template <size_t N>
+struct BoundParams {
+    static constexpr size_t CAPACITY = N > 0 ? N : 1;
+
+    const char* values[CAPACITY];
+    int lengths[CAPACITY];
+    int formats[CAPACITY];
+    Oid types[CAPACITY];
+    char scratch[CAPACITY][8];
+    size_t count = 0;
+
+    template <typename T>
+    void bind(const T& value) {
+        size_t i = count++;
+        values[i] = scratch[i];
+        lengths[i] = 0;
+        formats[i] = 1;
+        types[i] = 0;
+
+        using Decayed = typename std::decay<T>::type;
+        if constexpr (std::is_same<T, std::string>::value) {
+            values[i] = value.c_str();
+            formats[i] = 0;
+        } else if constexpr (std::is_same<T, std::string_view>::value) {
+            // A view need not be NUL-terminated, so it goes as binary text,
+            // whose wire form is the bytes themselves, with an explicit length.
+            values[i] = value.empty() ? "" : value.data();
+            lengths[i] = static_cast<int>(value.size());
+            types[i] = 25;  // text
+        } else if constexpr (std::is_same<Decayed, const char*>::value || std::is_same<Decayed, char*>::value) {
+            values[i] = value;
+            formats[i] = 0;
+        } else if constexpr (std::is_same<T, std::nullptr_t>::value) {
+            values[i] = nullptr;
+            formats[i] = 0;
+        } else if constexpr (std::is_same<T, bool>::value) {
+            types[i] = 16;  // bool
+            scratch[i][0] = value ? 1 : 0;
+            lengths[i] = 1;
+        } else if constexpr (std::is_enum<T>::value) {
+            count--;
+            bind(static_cast<typename std::underlying_type<T>::type>(value));
+        } else if constexpr (std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) <= 4) {
+            types[i] = 23;  // int4
+            putBigEndian(scratch[i], static_cast<uint32_t>(static_cast<int32_t>(value)), 4);
+            lengths[i] = 4;
+        } else if constexpr (std::is_integral<T>::value) {
+            types[i] = 20;  // int8
+            putBigEndian(scratch[i], static_cast<uint64_t>(static_cast<int64_t>(value)), 8);
+            lengths[i] = 8;
+        } else if constexpr (std::is_same<T, float>::value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            types[i] = 700;  // float4
+            putBigEndian(scratch[i], bits, 4);
+            lengths[i] = 4;
+        } else if constexpr (std::is_same<T, double>::value) {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            types[i] = 701;  // float8
+            putBigEndian(scratch[i], bits, 8);
+            lengths[i] = 8;
+        } else {
+            count--;
+            bindOptional(value);
+        }
+    }
+
+private:
+    static void putBigEndian(char* out, uint64_t value, int bytes) {
+        for (int b = bytes - 1; b >= 0; b--) {
+            out[b] = static_cast<char>(value & 0xFF);
+            value >>= 8;
+        }
+    }
+
+    template <typename T>
+    void bindOptional(const std::optional<T>& value) {
+        if (value) {
+            bind(*value);
+        } else {
+            bind(nullptr);
+        }
+    }
+};
 
 class DatabaseConnection {
+public:
+    // Controls transparent recovery from a dropped connection. Reconnects
+    // back off exponentially with jitter; read-only statements outside an
+    // explicit transaction are retried once on the fresh connection.
+    struct ReconnectPolicy {
+        int maxAttempts;
+        std::chrono::milliseconds initialBackoff;
+        std::chrono::milliseconds maxBackoff;
+        bool retryReadOnly;
+
+        ReconnectPolicy();
+    };
+
 private:
+    struct PreparedStatement {
+        std::string name;
+        std::vector<Oid> paramTypes;
+        std::list<std::string>::iterator lruPosition;
+    };
+
     PGconn* connection;
     std::string connectionString;
     bool connected;
+    bool reconnectable;
+    int resultFormat;
+
+    ReconnectPolicy reconnectPolicy;
+    std::mt19937 jitter;
+    // Set by beginTransaction() until commit/rollback. If the connection
+    // drops meanwhile, transactionLost makes every call fail until the
+    // caller ends the transaction, instead of reconnecting into autocommit.
+    bool transactionOpen;
+    bool transactionLost;
+
+    std::unordered_map<std::string, PreparedStatement> preparedStatements;
+    std::list<std::string> preparedLru;
+    std::vector<std::string> pendingDeallocations;
+    size_t statementCacheCapacity;
+    // Set while a Batch holds prepared statement names for its pipeline;
+    // eviction waits so none of them is deallocated before it is sent.
+    bool evictionDeferred;
+    unsigned long nextStatementId;
+    // Reused buffer for the cache keys of typed statements.
+    std::string statementKey;
+
+    struct AsyncQuery {
+        std::string query;
+        std::chrono::steady_clock::time_point started;
+        std::function<void(PGresult*)> callback;
+        PGresult* result;
+        bool resultsDone;
+    };
+
+    std::deque<AsyncQuery> asyncPending;
+
+    std::shared_ptr<QueryStatistics> statistics;
+    std::chrono::steady_clock::time_point lastWriteTime;
+
+    std::vector<std::string> listenChannels;
+
+    std::shared_ptr<QueryCache> resultCache;
+    std::string cacheKey;
+    // Writes made inside the open transaction; invalidated again once it
+    // ends, since other connections may have cached pre-commit rows.
+    std::unordered_set<std::string> transactionWrites;
 
 public:
+    // Queues parameterized statements and sends them in one network flight
+    // using libpq pipeline mode. Outside an explicit transaction the whole
+    // batch runs as one implicit transaction: an error rolls back every
+    // statement and the rest report PGRES_PIPELINE_ABORTED.
+    class Batch {
+    private:
+        struct Statement {
+            std::string query;
+            std::vector<std::string> params;
+        };
+
+        DatabaseConnection& connection;
+        std::vector<Statement> statements;
+        std::vector<PGresult*> results;
+
+    public:
+        explicit Batch(DatabaseConnection& connection);
+        ~Batch();
+
+        size_t add(const std::string& query, const std::vector<std::string>& params = std::vector<std::string>());
+        size_t size() const;
+        bool empty() const;
+        void clear();
+
+        bool execute();
+
+        bool succeeded(size_t index) const;
+        PGresult* takeResult(size_t index);
+        std::string getError(size_t index) const;
+
+    private:
+        void clearResults();
+        bool flushPipeline(PGconn* conn);
+    };
+
+    // Bulk loader over COPY ... FROM STDIN. Rows are encoded into a local
+    // buffer and handed to libpq in large chunks, so a load costs one round
+    // trip instead of one per row. Fields are appended with the add*()
+    // methods and closed with endRow(); writeRow() is shorthand for rows of
+    // plain strings. In BINARY format each add*() call must match the
+    // column's type (addField() sends raw bytes, which suits text columns).
+    class CopyWriter {
+    public:
+        enum Format { TEXT, BINARY };
+
+    private:
+        DatabaseConnection& connection;
+        Format format;
+        size_t flushThreshold;
+        std::string buffer;
+        size_t rowStart;
+        int fieldsInRow;
+        int expectedFields;
+        long long rowsWritten;
+        unsigned long long bytesSent;
+        std::string copyQuery;
+        std::chrono::steady_clock::time_point started;
+        bool active;
+        std::string error;
+
+    public:
+        explicit CopyWriter(DatabaseConnection& connection, Format format = TEXT,
+                            size_t flushThreshold = 64 * 1024);
+        ~CopyWriter();
+
+        // Names are sent as quoted identifiers, so they match case-sensitively;
+        // a dot in the table name separates the schema.
+        bool begin(const std::string& table, const std::vector<std::string>& columns = std::vector<std::string>());
+
+        void addField(const std::string& value);
+        void addField(const char* value, size_t length);
+        void addNull();
+        void addInt(int value);
+        void addInt64(long long value);
+        void addDouble(double value);
+        void addBool(bool value);
+        void addDate(const std::string& isoDate);
+        bool endRow();
+        bool writeRow(const std::vector<std::string>& values);
+
+        bool finish();
+        void abort(const std::string& reason = "COPY aborted by client");
+
+        bool isActive() const;
+        long long getRowCount() const;
+        std::string getError() const;
+
+    private:
+        void beginField();
+        bool flush();
+        void fail(const std::string& message);
+    };
+
     DatabaseConnection();
     DatabaseConnection(const std::string& host, const std::string& port,
                       const std::string& dbname, const std::string& user,
@@ -26,15 +286,86 @@ public:
                 const std::string& password);
     void disconnect();
     bool isConnected() const;
+    bool reconnect();
+    bool ping();
+    // True between BEGIN and COMMIT/ROLLBACK, including a transaction whose
+    // connection was lost and has not been rolled back by the caller yet.
+    bool inTransaction() const;
+
+    // When this connection last completed a statement that may have written;
+    // used to keep reads on the primary right after a write.
+    std::chrono::steady_clock::time_point getLastWriteTime() const;
 
     PGresult* executeQuery(const std::string& query);
     PGresult* executeParameterizedQuery(const std::string& query,
                                        const std::vector<std::string>& params);
 
+    // Asynchronous execution: queries are pipelined on this connection and
+    // complete in order. The callback receives ownership of the result, or
+    // nullptr on failure; the future's DatabaseResult owns it from the moment
+    // it arrives, so a future dropped unread frees it. Results are delivered by
+    // processAsync()/waitForAsync(), which the caller drives; synchronous
+    // calls on this connection drain outstanding async queries first.
+    std::future<DatabaseResult> executeAsync(const std::string& query,
+                                             const std::vector<std::string>& params = std::vector<std::string>());
+    bool executeAsync(const std::string& query, const std::vector<std::string>& params,
+                      std::function<void(PGresult*)> callback);
+    bool processAsync(int timeoutMs = 0);
+    bool waitForAsync();
+    size_t getPendingAsyncCount() const;
+    int getSocket() const;
+
+    // LISTEN/NOTIFY. Channels are re-subscribed after a reconnect, but
+    // notifications sent while disconnected are lost. pollNotifications()
+    // waits up to timeoutMs (-1 blocks) for input, then hands every queued
+    // notification to the handler. Returns false if the connection is gone.
+    using NotificationHandler = std::function<void(const std::string& channel, const std::string& payload, int pid)>;
+    bool listen(const std::string& channel);
+    bool unlisten(const std::string& channel);
+    bool pollNotifications(int timeoutMs, const NotificationHandler& handler);
+
+    // Streams a result set row by row using libpq single-row mode, so memory
+    // stays constant regardless of result size. The visitor sees a
+    // DatabaseResult positioned on the current row and returns false to stop;
+    // the query is then cancelled and only rows already sent are drained.
+    // Inside a transaction, which a cancel would abort, the rest is drained.
+    bool forEachRow(const std::string& query, const std::function<bool(DatabaseResult&)>& visitor);
+    bool forEachRow(const std::string& query, const std::vector<std::string>& params,
+                    const std::function<bool(DatabaseResult&)>& visitor);
+
+    // Runs a COPY ... TO STDOUT statement and writes the server's output
+    // chunks straight to the stream or file descriptor, unparsed.
+    bool copyOut(const std::string& copyQuery, std::ostream& out);
+    bool copyOut(const std::string& copyQuery, int fd);
+
     bool executeNonQuery(const std::string& query);
     bool executeParameterizedNonQuery(const std::string& query,
                                      const std::vector<std::string>& params);
 
+    // Typed parameters without building string vectors:
+    //   execute("SELECT * FROM t WHERE status = $1 AND company = $2", status, company);
+    // Integers, enums, bool, float and double are sent in binary with their
+    // type OID; strings and C strings are borrowed as text with the type left
+    // to the server; nullptr and an empty std::optional send NULL. Binding
+    // allocates nothing. Returns the result like executeParameterizedQuery.
+    template <typename... Args>
+    PGresult* execute(const std::string& query, const Args&... args) {
+        BoundParams<sizeof...(Args)> params;
+        (params.bind(args), ...);
+        return executeBound(query, static_cast<int>(params.count), params.values,
+                            params.lengths, params.formats, params.types);
+    }
+
+    template <typename Arg, typename... Args>
+    bool executeNonQuery(const std::string& query, const Arg& first, const Args&... rest) {
+        PGresult* result = execute(query, first, rest...);
+        if (!result) {
+            return false;
+        }
+        PQclear(result);
+        return true;
+    }
+
     std::string escapeString(const std::string& input);
     std::string getLastError() const;
 
@@ -42,6 +373,32 @@ public:
     bool commitTransaction();
     bool rollbackTransaction();
 
+    // Binary results skip text formatting on the server and parsing on the
+    // client; DatabaseResult decodes both formats transparently. Applies to
+    // parameterized, batched, async and streaming queries (PQexec is text only).
+    void setBinaryResults(bool binary);
+    bool getBinaryResults() const;
+
+    void setReconnectPolicy(const ReconnectPolicy& policy);
+    const ReconnectPolicy& getReconnectPolicy() const;
+
+    // Every statement is timed into the shared QueryStatistics registry
+    // unless a different one (or nullptr, to opt out) is set here.
+    void setStatistics(std::shared_ptr<QueryStatistics> statistics);
+    std::shared_ptr<QueryStatistics> getStatistics() const;
+
+    // Reads through executeQuery, executeParameterizedQuery and execute()
+    // outside a transaction are served from this cache when possible; every
+    // successful write invalidates it. Defaults to QueryCache::getInstance(),
+    // which is null (no caching) unless the application installs one.
+    void setResultCache(std::shared_ptr<QueryCache> cache);
+    std::shared_ptr<QueryCache> getResultCache() const;
+
+    void setStatementCacheCapacity(size_t capacity);
+    size_t getStatementCacheCapacity() const;
+    size_t getPreparedStatementCount() const;
+    void clearStatementCache();
+
     static std::shared_ptr<DatabaseConnection> getInstance();
     static void setInstance(std::shared_ptr<DatabaseConnection> instance);
 
@@ -50,6 +407,163 @@ private:
     void buildConnectionString(const std::string& host, const std::string& port,
                               const std::string& dbname, const std::string& user,
                               const std::string& password);
+
+    void closeConnection();
+    bool ensureConnected();
+    bool connectionLost() const;
+    bool canRetry(const std::string& query) const;
+    static bool isReadOnlyStatement(const std::string& query);
+
+    bool cacheable(const std::string& query) const;
+    PGresult* executeBound(const std::string& query, int count, const char* const* values,
+                           const int* lengths, const int* formats, const Oid* types);
+    PGresult* execParameterized(const std::string& query, int count, const char* const* values,
+                                const int* lengths, const int* formats, const Oid* types);
+    bool forEachRowOnce(const std::string& query, const std::vector<std::string>& params,
+                        const std::function<bool(DatabaseResult&)>& visitor, unsigned long long& rows);
+    // Asks the server to stop a streaming query whose visitor has had enough,
+    // so only the rows already in flight are left to drain.
+    void cancelStreamingQuery();
+    static bool isQueryCanceled(const PGresult* result);
+
+    // Typed statements are cached under "query\0type,type,..."; everything
+    // up to the NUL is the SQL that gets prepared.
+    const PreparedStatement* prepareStatement(const std::string& query, const Oid* paramTypes = nullptr,
+                                              int paramCount = 0);
+    void forgetPreparedStatement(const std::string& query);
+    void evictPreparedStatements();
+    void deallocatePendingStatements();
+    void reprepareStatements();
+    void relistenChannels();
+
+    void recordStatement(const std::string& query, std::chrono::microseconds elapsed,
+                         const PGresult* result, bool failed);
+    void recordStatement(const std::string& query, std::chrono::microseconds elapsed,
+                         unsigned long long rows, unsigned long long bytes, bool failed);
+
+    bool streamCopyOut(const std::string& copyQuery, const std::function<bool(const char*, int)>& sink);
+
+    bool dispatchAsyncResults();
+    void failPendingAsync();
+    void finishAsync();
+};
+
+// Column names of a result and a hashed name -> index map over them. Built
+// once per result shape; the single-row results of a streamed query share one.
+class ResultColumns {
+private:
+    std::vector<std::string> names;
+    std::unordered_map<std::string_view, int> indexes;
+
+public:
+    explicit ResultColumns(const PGresult* result);
+    ResultColumns(const ResultColumns&) = delete;
+    ResultColumns& operator=(const ResultColumns&) = delete;
+
+    int size() const;
+    const std::string& nameAt(int fieldIndex) const;
+    int indexOf(std::string_view name) const;
+};
+
+// Immutable flat copy of a whole result. Every value lives in one
+// contiguous buffer, indexed through an offset table, with a null bitmap;
+// column names are shared. RowSet, Row and Column are cheap handles over
+// the same reference-counted storage, so they may outlive the result.
+class RowSet {
+private:
+    struct Data {
+        std::shared_ptr<const ResultColumns> columns;
+        int rowCount;
+        int fieldCount;
+        std::string arena;
+        std::vector<size_t> offsets;  // rowCount * fieldCount + 1 entries
+        std::vector<uint64_t> nullBits;
+
+        bool isNull(int row, int fieldIndex) const;
+        std::string_view value(int row, int fieldIndex) const;
+    };
+
+    std::shared_ptr<const Data> data;
+
+    explicit RowSet(std::shared_ptr<const Data> data);
+    friend class DatabaseResult;
+
+public:
+    class Row {
+    private:
+        std::shared_ptr<const Data> data;
+        int row;
+
+        Row(std::shared_ptr<const Data> data, int row);
+        friend class RowSet;
+
+    public:
+        Row();
+
+        int size() const;
+        bool isNull(int fieldIndex) const;
+        bool isNull(std::string_view fieldName) const;
+        // Empty for NULL, out-of-range and unknown columns.
+        std::string_view operator[](int fieldIndex) const;
+        std::string_view operator[](std::string_view fieldName) const;
+    };
+
+    class Column {
+    private:
+        std::shared_ptr<const Data> data;
+        int fieldIndex;
+
+        Column(std::shared_ptr<const Data> data, int fieldIndex);
+        friend class RowSet;
+
+    public:
+        Column();
+
+        int size() const;
+        std::string getName() const;
+        bool isNull(int row) const;
+        std::string_view operator[](int row) const;
+    };
+
+    RowSet();
+
+    int size() const;
+    bool empty() const;
+    int getFieldCount() const;
+    std::string getFieldName(int fieldIndex) const;
+    int getFieldIndex(std::string_view fieldName) const;
+
+    Row operator[](int row) const;
+    Column column(int fieldIndex) const;
+    Column column(std::string_view fieldName) const;
+};
+
+// One result column decoded into a contiguous array plus a validity
+// bitmap. NULL slots hold T(), so sums and counts can run straight over
+// values() and consult isValid() only where NULL matters.
+template <typename T>
+class TypedColumn {
+private:
+    std::string name;
+    std::vector<T> data;
+    std::vector<uint64_t> validity;
+    int nullCount;
+
+    friend class DatabaseResult;
+
+public:
+    TypedColumn() : nullCount(0) {}
+
+    const std::string& getName() const { return name; }
+    int size() const { return static_cast<int>(data.size()); }
+    bool empty() const { return data.empty(); }
+    int getNullCount() const { return nullCount; }
+
+    const std::vector<T>& values() const { return data; }
+    const T& operator[](int row) const { return data[row]; }
+    bool isValid(int row) const { return (validity[row / 64] >> (row % 64)) & 1; }
+    // Bit i of word i / 64 is set when row i is not NULL.
+    const std::vector<uint64_t>& getValidityBitmap() const { return validity; }
 };
 
 class DatabaseResult {
@@ -59,8 +573,20 @@ private:
     int numRows;
     int numFields;
 
+    // Built on the first lookup by name unless supplied by the caller.
+    mutable std::shared_ptr<const ResultColumns> columns;
+    // Text renderings of binary-format values handed out by getStringView.
+    mutable std::vector<std::string> convertedValues;
+    // Materialized by the first getAllRows().
+    mutable RowSet rowSet;
+
 public:
     DatabaseResult(PGresult* result);
+    DatabaseResult(PGresult* result, std::shared_ptr<const ResultColumns> columns);
+    DatabaseResult(DatabaseResult&& other) noexcept;
+    DatabaseResult& operator=(DatabaseResult&& other) noexcept;
+    DatabaseResult(const DatabaseResult&) = delete;
+    DatabaseResult& operator=(const DatabaseResult&) = delete;
     ~DatabaseResult();
 
     bool isValid() const;
@@ -71,22 +597,47 @@ public:
     void reset();
 
     std::string getString(int fieldIndex) const;
-    std::string getString(const std::string& fieldName) const;
+    std::string getString(std::string_view fieldName) const;
     int getInt(int fieldIndex) const;
-    int getInt(const std::string& fieldName) const;
+    int getInt(std::string_view fieldName) const;
+    long long getInt64(int fieldIndex) const;
+    long long getInt64(std::string_view fieldName) const;
     double getDouble(int fieldIndex) const;
-    double getDouble(const std::string& fieldName) const;
+    double getDouble(std::string_view fieldName) const;
     bool getBool(int fieldIndex) const;
-    bool getBool(const std::string& fieldName) const;
+    bool getBool(std::string_view fieldName) const;
+
+    // The value without copying: points into the PGresult and stays valid
+    // while this DatabaseResult lives. Binary-format values that need
+    // converting to text are rendered into a per-column buffer instead,
+    // valid until the same column is read again. NULL gives an empty view.
+    std::string_view getStringView(int fieldIndex) const;
+    std::string_view getStringView(std::string_view fieldName) const;
 
     bool isNull(int fieldIndex) const;
-    bool isNull(const std::string& fieldName) const;
+    bool isNull(std::string_view fieldName) const;
 
     std::string getFieldName(int fieldIndex) const;
-    int getFieldIndex(const std::string& fieldName) const;
+    int getFieldIndex(std::string_view fieldName) const;
+    std::shared_ptr<const ResultColumns> getColumns() const;
+
+    // Decodes every row of one column in a single pass, independent of the
+    // cursor. T is int, long long, double, float or std::string; an unknown
+    // column gives an empty TypedColumn.
+    template <typename T>
+    TypedColumn<T> column(std::string_view fieldName) const;
+    template <typename T>
+    TypedColumn<T> column(int fieldIndex) const;
 
-    std::vector<std::map<std::string, std::string>> getAllRows() const;
-    std::map<std::string, std::string> getCurrentRow() const;
+    // The whole result as text, built once and shared by later calls.
+    RowSet getAllRows() const;
+    // Copies only the current row unless getAllRows() already ran.
+    RowSet::Row getCurrentRow() const;
+
+private:
+    std::shared_ptr<const RowSet::Data> copyRows(int firstRow, int rowCount) const;
+    const char* rawValue(int fieldIndex) const;
+    std::string valueAsText(int row, int fieldIndex) const;
 };
 
 #endif // DATABASE_H
\ No newline at end of file
@@ -2,23 +2,60 @@
 #define JOBAPPLICATIONCONTROLLER_H
 
 #include "baseController.h"
+#include "jobApplicationRepository.h"
+#include "jobApplicationQuery.h"
 #include "../ds/resume/jobApplication.h"
 #include <vector>
+#include <map>
 #include <memory>
+#include <functional>
+#include <ostream>
 
 class JobApplicationController : public BaseController {
+private:
+    // Every read and write goes here; the controller itself holds no
+    // connection. All but the repository constructor store in Postgres
+    // through a PostgresJobApplicationRepository.
+    std::shared_ptr<JobApplicationRepository> repository;
+
 public:
     JobApplicationController();
+    explicit JobApplicationController(std::shared_ptr<ConnectionPool> pool);
+    explicit JobApplicationController(std::shared_ptr<ConnectionRouter> router);
+    explicit JobApplicationController(std::shared_ptr<JobApplicationRepository> repository);
     ~JobApplicationController() = default;
 
     bool createJobApplication(const JobApplication& application);
+    // Creates many applications, `batchSize` per transaction where the
+    // repository batches. A rejected row is reported without failing the
+    // others.
+    BulkCreateResult createJobApplications(const std::vector<JobApplication>& applications, size_t batchSize = 1000);
     std::unique_ptr<JobApplication> getJobApplicationById(const std::string& applicationId);
     std::vector<std::unique_ptr<JobApplication>> getAllJobApplications();
+    bool forEachJobApplication(const std::function<bool(const JobApplication&)>& callback);
     std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByCompany(const std::string& company);
     std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByStatus(ApplicationStatus status);
     std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByDateRange(const std::string& startDate, const std::string& endDate);
 
+    // Any combination of filters in one statement; see JobApplicationQuery.
+    std::vector<std::unique_ptr<JobApplication>> findJobApplications(const JobApplicationQuery& query);
+
+    // Paginated variants of the lists above, same order. On Postgres each
+    // page seeks straight to its cursor, so deep pages cost the same as the
+    // first.
+    JobApplicationPage getJobApplicationsPage(size_t pageSize, const std::string& cursor = "");
+    JobApplicationPage getJobApplicationsByCompanyPage(const std::string& company, size_t pageSize,
+                                                       const std::string& cursor = "");
+    JobApplicationPage getJobApplicationsByStatusPage(ApplicationStatus status, size_t pageSize,
+                                                      const std::string& cursor = "");
+    JobApplicationPage getJobApplicationsByDateRangePage(const std::string& startDate, const std::string& endDate,
+                                                         size_t pageSize, const std::string& cursor = "");
+
+    // Fails if the application does not exist. Only dates added or removed
+    // since the stored version touch the child tables; dates are a set.
     bool updateJobApplication(const JobApplication& application);
+    // Creates the application, or updates it in place if the ID is taken.
+    bool upsertJobApplication(const JobApplication& application);
     bool updateJobApplicationStatus(const std::string& applicationId, ApplicationStatus status);
     bool addInterviewDate(const std::string& applicationId, const std::string& interviewDate);
     bool addFollowUpDate(const std::string& applicationId, const std::string& followUpDate);
@@ -28,9 +65,12 @@ public:
 
     int getJobApplicationCount() const;
     int getJobApplicationCountByStatus(ApplicationStatus status) const;
+    std::map<ApplicationStatus, int> getJobApplicationCountsByStatus(const std::vector<ApplicationStatus>& statuses) const;
 
     std::string exportToJson() override;
     std::string exportToCsv() override;
+    bool exportToJson(std::ostream& out);
+    bool exportToCsv(std::ostream& out);
     bool importFromJson(const std::string& jsonData) override;
     bool importFromCsv(const std::string& csvData);
 
@@ -38,14 +78,7 @@ public:
     bool jobApplicationExists(const std::string& applicationId) const;
 
 private:
-    JobApplication* mapResultToJobApplication(DatabaseResult& result);
-    std::vector<std::string> getInterviewDates(const std::string& applicationId);
-    std::vector<std::string> getFollowUpDates(const std::string& applicationId);
-    bool deleteInterviewDates(const std::string& applicationId);
-    bool deleteFollowUpDates(const std::string& applicationId);
-    bool insertInterviewDates(const std::string& applicationId, const std::vector<std::string>& dates);
-    bool insertFollowUpDates(const std::string& applicationId, const std::vector<std::string>& dates);
-    std::string applicationToJsonString(const JobApplication& application, bool includeComma = true);
+    std::string applicationToJsonString(const JobApplication& application);
 };
 
 #endif // JOBAPPLICATIONCONTROLLER_H
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include "jobApplicationQuery.h"
+#include <algorithm>
+#include <cctype>
+
+static std::string toLower(const std::string& value) {
+    std::string lower = value;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower;
+}
+
+JobApplicationQuery::JobApplicationQuery() : order(Order::NEWEST_FIRST), maxResults(0) {}
+
+JobApplicationQuery& JobApplicationQuery::company(const std::string& company) {
+    companyFilter = company;
+    return *this;
+}
+
+JobApplicationQuery& JobApplicationQuery::status(ApplicationStatus status) {
+    return statuses({status});
+}
+
+JobApplicationQuery& JobApplicationQuery::statuses(const std::vector<ApplicationStatus>& statuses) {
+    statusFilter = statuses;
+    return *this;
+}
+
+JobApplicationQuery& JobApplicationQuery::appliedFrom(const std::string& startDate) {
+    fromDate = startDate;
+    return *this;
+}
+
+JobApplicationQuery& JobApplicationQuery::appliedTo(const std::string& endDate) {
+    toDate = endDate;
+    return *this;
+}
+
+JobApplicationQuery& JobApplicationQuery::appliedBetween(const std::string& startDate, const std::string& endDate) {
+    return appliedFrom(startDate).appliedTo(endDate);
+}
+
+JobApplicationQuery& JobApplicationQuery::referralSource(const std::string& source) {
+    referralFilter = source;
+    return *this;
+}
+
+JobApplicationQuery& JobApplicationQuery::withInterview(bool hasInterview) {
+    interviewFilter = hasInterview;
+    return *this;
+}
+
+JobApplicationQuery& JobApplicationQuery::orderBy(Order order) {
+    this->order = order;
+    return *this;
+}
+
+JobApplicationQuery& JobApplicationQuery::limit(size_t maxResults) {
+    this->maxResults = maxResults;
+    return *this;
+}
+
+std::string JobApplicationQuery::toSql(std::vector<std::string>& params) const {
+    auto bind = [&params](const std::string& value) {
+        params.push_back(value);
+        return "$" + std::to_string(params.size());
+    };
+
+    std::vector<std::string> conditions;
+    if (companyFilter) {
+        conditions.push_back("LOWER(ja.company) LIKE LOWER(" + bind("%" + *companyFilter + "%") + ")");
+    }
+    if (statusFilter) {
+        std::string statusArray = "{";
+        for (size_t i = 0; i < statusFilter->size(); i++) {
+            statusArray += (i > 0 ? "," : "") + std::to_string(static_cast<int>((*statusFilter)[i]));
+        }
+        conditions.push_back("ja.status = ANY(" + bind(statusArray + "}") + "::integer[])");
+    }
+    if (fromDate) {
+        conditions.push_back("ja.date_applied >= " + bind(*fromDate) + "::date");
+    }
+    if (toDate) {
+        conditions.push_back("ja.date_applied <= " + bind(*toDate) + "::date");
+    }
+    if (referralFilter) {
+        conditions.push_back("LOWER(ja.referral_source) = LOWER(" + bind(*referralFilter) + ")");
+    }
+    if (interviewFilter) {
+        conditions.push_back(std::string(*interviewFilter ? "" : "NOT ") +
+                             "EXISTS (SELECT 1 FROM interview_dates i WHERE i.application_id = ja.application_id)");
+    }
+
+    std::string sql = "SELECT ja.* FROM job_applications ja";
+    for (size_t i = 0; i < conditions.size(); i++) {
+        sql += (i == 0 ? " WHERE " : " AND ") + conditions[i];
+    }
+
+    // Ties on a date are broken by application_id in byte order, the same
+    // key sortAndLimit() uses, so a limit picks the same rows either way.
+    switch (order) {
+        case Order::NEWEST_FIRST:
+            sql += " ORDER BY ja.date_applied DESC, ja.application_id COLLATE \"C\" DESC";
+            break;
+        case Order::OLDEST_FIRST:
+            sql += " ORDER BY ja.date_applied ASC, ja.application_id COLLATE \"C\" ASC";
+            break;
+        case Order::COMPANY:
+            sql += " ORDER BY LOWER(ja.company), ja.date_applied DESC, ja.application_id COLLATE \"C\" DESC";
+            break;
+    }
+
+    if (maxResults > 0) {
+        sql += " LIMIT " + bind(std::to_string(maxResults));
+    }
+    return sql;
+}
+
+bool JobApplicationQuery::matches(const JobApplication& application) const {
+    if (companyFilter && toLower(application.getCompany()).find(toLower(*companyFilter)) == std::string::npos) {
+        return false;
+    }
+    if (statusFilter &&
+        std::find(statusFilter->begin(), statusFilter->end(), application.getStatus()) == statusFilter->end()) {
+        return false;
+    }
+    if (fromDate && application.getDateApplied() < *fromDate) {
+        return false;
+    }
+    if (toDate && application.getDateApplied() > *toDate) {
+        return false;
+    }
+    if (referralFilter && toLower(application.getReferralSource()) != toLower(*referralFilter)) {
+        return false;
+    }
+    if (interviewFilter && application.getInterviewDates().empty() == *interviewFilter) {
+        return false;
+    }
+    return true;
+}
+
+void JobApplicationQuery::sortAndLimit(std::vector<std::unique_ptr<JobApplication>>& applications) const {
+    auto newestFirst = [](const std::unique_ptr<JobApplication>& a, const std::unique_ptr<JobApplication>& b) {
+        if (a->getDateApplied() != b->getDateApplied()) {
+            return a->getDateApplied() > b->getDateApplied();
+        }
+        return a->getApplicationId() > b->getApplicationId();
+    };
+
+    switch (order) {
+        case Order::NEWEST_FIRST:
+            std::sort(applications.begin(), applications.end(), newestFirst);
+            break;
+        case Order::OLDEST_FIRST:
+            std::sort(applications.begin(), applications.end(),
+                      [&newestFirst](const std::unique_ptr<JobApplication>& a, const std::unique_ptr<JobApplication>& b) {
+                          return newestFirst(b, a);
+                      });
+            break;
+        case Order::COMPANY:
+            std::sort(applications.begin(), applications.end(),
+                      [&newestFirst](const std::unique_ptr<JobApplication>& a, const std::unique_ptr<JobApplication>& b) {
+                          std::string companyA = toLower(a->getCompany());
+                          std::string companyB = toLower(b->getCompany());
+                          if (companyA != companyB) {
+                              return companyA < companyB;
+                          }
+                          return newestFirst(a, b);
+                      });
+            break;
+    }
+
+    if (maxResults > 0 && applications.size() > maxResults) {
+        applications.resize(maxResults);
+    }
+}
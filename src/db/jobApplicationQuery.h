@@ -0,0 +1,70 @@
+#ifndef JOBAPPLICATIONQUERY_H
+#define JOBAPPLICATIONQUERY_H
+
+#include "../ds/resume/jobApplication.h"
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+// A search over job applications that combines any of the filters below,
+// all of which must match. JobApplicationController::findJobApplications()
+// runs it as a single parameterized statement. Every value travels as a
+// parameter and a status set is one array parameter, so the SQL text
+// depends only on which filters are set. Repeated searches of the same
+// shape reuse one prepared statement.
+//
+//   JobApplicationQuery query;
+//   query.company("acme").statuses({ApplicationStatus::APPLIED, ApplicationStatus::REVIEWING})
+//        .appliedFrom("2024-01-01").withInterview(false).limit(20);
+class JobApplicationQuery {
+public:
+    // Applications on the same date are ordered by application_id, on
+    // every backend.
+    enum class Order {
+        NEWEST_FIRST,
+        OLDEST_FIRST,
+        COMPANY
+    };
+
+private:
+    std::optional<std::string> companyFilter;
+    std::optional<std::vector<ApplicationStatus>> statusFilter;
+    std::optional<std::string> fromDate;
+    std::optional<std::string> toDate;
+    std::optional<std::string> referralFilter;
+    std::optional<bool> interviewFilter;
+    Order order;
+    size_t maxResults;
+
+public:
+    JobApplicationQuery();
+
+    // Case-insensitive substring match, like getJobApplicationsByCompany().
+    JobApplicationQuery& company(const std::string& company);
+    // Any of the given statuses; an empty set matches nothing.
+    JobApplicationQuery& status(ApplicationStatus status);
+    JobApplicationQuery& statuses(const std::vector<ApplicationStatus>& statuses);
+    // Inclusive bounds on date_applied; either may be left open.
+    JobApplicationQuery& appliedFrom(const std::string& startDate);
+    JobApplicationQuery& appliedTo(const std::string& endDate);
+    JobApplicationQuery& appliedBetween(const std::string& startDate, const std::string& endDate);
+    // Case-insensitive exact match.
+    JobApplicationQuery& referralSource(const std::string& source);
+    // true: at least one interview date; false: none.
+    JobApplicationQuery& withInterview(bool hasInterview = true);
+    JobApplicationQuery& orderBy(Order order);
+    // 0 (the default) returns every match.
+    JobApplicationQuery& limit(size_t maxResults);
+
+    // The SELECT for this query over job_applications, with its parameters
+    // appended to `params` in placeholder order.
+    std::string toSql(std::vector<std::string>& params) const;
+
+    // Evaluates the filters in C++, for storage that has no SQL.
+    bool matches(const JobApplication& application) const;
+    // Orders by this query's sort and applies its limit.
+    void sortAndLimit(std::vector<std::unique_ptr<JobApplication>>& applications) const;
+};
+
+#endif // JOBAPPLICATIONQUERY_H
@@ -0,0 +1,146 @@
+#include "jobApplicationRepository.h"
+#include "baseController.h"
+#include <algorithm>
+
+namespace {
+
+std::string joinDates(const std::vector<std::string>& dates) {
+    std::string joined;
+    for (const auto& date : dates) {
+        if (!joined.empty()) {
+            joined += ';';
+        }
+        joined += date;
+    }
+    return joined;
+}
+
+} // namespace
+
+BulkCreateResult JobApplicationRepository::createJobApplications(const std::vector<JobApplication>& applications,
+                                                                  size_t batchSize) {
+    BulkCreateResult outcome;
+    for (size_t i = 0; i < applications.size(); i++) {
+        if (createJobApplication(applications[i])) {
+            outcome.created++;
+        } else {
+            outcome.failures.emplace_back(i, "could not be stored");
+        }
+    }
+    return outcome;
+}
+
+bool JobApplicationRepository::upsertJobApplication(const JobApplication& application) {
+    if (jobApplicationExists(application.getApplicationId())) {
+        return updateJobApplication(application);
+    }
+    return createJobApplication(application);
+}
+
+std::vector<std::unique_ptr<JobApplication>> JobApplicationRepository::findJobApplications(
+        const JobApplicationQuery& query) {
+    std::vector<std::unique_ptr<JobApplication>> applications = getAllJobApplications();
+    applications.erase(std::remove_if(applications.begin(), applications.end(),
+                                      [&query](const std::unique_ptr<JobApplication>& app) {
+                                          return !query.matches(*app);
+                                      }),
+                       applications.end());
+    query.sortAndLimit(applications);
+    return applications;
+}
+
+JobApplicationPage JobApplicationRepository::getJobApplicationsPage(size_t pageSize, const std::string& cursor) {
+    return slicePage(getAllJobApplications(), pageSize, cursor);
+}
+
+JobApplicationPage JobApplicationRepository::getJobApplicationsByCompanyPage(const std::string& company,
+                                                                             size_t pageSize,
+                                                                             const std::string& cursor) {
+    return slicePage(getJobApplicationsByCompany(company), pageSize, cursor);
+}
+
+JobApplicationPage JobApplicationRepository::getJobApplicationsByStatusPage(ApplicationStatus status,
+                                                                            size_t pageSize,
+                                                                            const std::string& cursor) {
+    return slicePage(getJobApplicationsByStatus(status), pageSize, cursor);
+}
+
+JobApplicationPage JobApplicationRepository::getJobApplicationsByDateRangePage(const std::string& startDate,
+                                                                               const std::string& endDate,
+                                                                               size_t pageSize,
+                                                                               const std::string& cursor) {
+    return slicePage(getJobApplicationsByDateRange(startDate, endDate), pageSize, cursor);
+}
+
+std::map<ApplicationStatus, int> JobApplicationRepository::getJobApplicationCountsByStatus(
+        const std::vector<ApplicationStatus>& statuses) const {
+    std::map<ApplicationStatus, int> counts;
+    for (ApplicationStatus status : statuses) {
+        counts[status] = getJobApplicationCountByStatus(status);
+    }
+    return counts;
+}
+
+bool JobApplicationRepository::exportToCsv(std::ostream& out) {
+    out << "Application ID,Job ID,Job Title,Company,Date Applied,Status,Contact Name,Contact Email,"
+           "Contact Phone,Comments,Application URL,Salary Offered,Expected Salary,Response Deadline,"
+           "Referral Source,Application Method,Notes,Interview Dates,Follow Up Dates\n";
+
+    return forEachJobApplication([&out](const JobApplication& app) {
+        const std::string fields[] = {
+            app.getApplicationId(), app.getJobId(), app.getJobTitle(), app.getCompany(), app.getDateApplied(),
+            JobApplication::statusToString(app.getStatus()), app.getContactName(), app.getContactEmail(),
+            app.getContactPhone(), app.getComments(), app.getApplicationUrl(), app.getSalaryOffered(),
+            app.getExpectedSalary(), app.getResponseDeadline(), app.getReferralSource(),
+            app.getApplicationMethod(), app.getNotes(), joinDates(app.getInterviewDates()),
+            joinDates(app.getFollowUpDates())
+        };
+        for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+            out << (i > 0 ? "," : "") << BaseController::escapeCsvField(fields[i]);
+        }
+        out << '\n';
+        return true;
+    });
+}
+
+bool JobApplicationRepository::parseCursor(const std::string& cursor, std::string& dateApplied, std::string& key) {
+    size_t separator = cursor.find('|');
+    if (separator == std::string::npos || separator + 1 == cursor.size()) {
+        return false;
+    }
+    dateApplied = cursor.substr(0, separator);
+    key = cursor.substr(separator + 1);
+    return true;
+}
+
+JobApplicationPage JobApplicationRepository::slicePage(std::vector<std::unique_ptr<JobApplication>> applications,
+                                                       size_t pageSize, const std::string& cursor) {
+    JobApplicationPage page;
+    if (pageSize == 0) {
+        return page;
+    }
+
+    auto first = applications.begin();
+    if (!cursor.empty()) {
+        std::string dateApplied, applicationId;
+        if (!parseCursor(cursor, dateApplied, applicationId)) {
+            return page;
+        }
+        first = std::find_if(applications.begin(), applications.end(),
+                             [&dateApplied, &applicationId](const std::unique_ptr<JobApplication>& app) {
+                                 return std::make_pair(app->getDateApplied(), app->getApplicationId()) <
+                                        std::make_pair(dateApplied, applicationId);
+                             });
+    }
+
+    size_t available = static_cast<size_t>(applications.end() - first);
+    auto last = first + std::min(pageSize, available);
+    for (auto it = first; it != last; ++it) {
+        page.applications.push_back(std::move(*it));
+    }
+    if (available > pageSize) {
+        const JobApplication& tail = *page.applications.back();
+        page.nextCursor = tail.getDateApplied() + "|" + tail.getApplicationId();
+    }
+    return page;
+}
@@ -0,0 +1,103 @@
+#ifndef JOBAPPLICATIONREPOSITORY_H
+#define JOBAPPLICATIONREPOSITORY_H
+
+#include "jobApplicationQuery.h"
+#include "../ds/resume/jobApplication.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// One page of a keyset-paginated listing. Pass nextCursor back to fetch the
+// following page; it is empty once there is nothing after this one.
+struct JobApplicationPage {
+    std::vector<std::unique_ptr<JobApplication>> applications;
+    std::string nextCursor;
+};
+
+// Outcome of createJobApplications(): how many were stored, plus the input
+// index and reason for each application that was not.
+struct BulkCreateResult {
+    size_t created;
+    std::vector<std::pair<size_t, std::string>> failures;
+
+    BulkCreateResult() : created(0) {}
+};
+
+// Storage behind JobApplicationController; the controller sends every read
+// and write through one. PostgresJobApplicationRepository is the default.
+// Implementations answer with the same semantics as the Postgres SQL:
+// lists are ordered by date_applied, newest first; company search is a
+// case-insensitive substring match; date ranges are inclusive; interview
+// and follow-up dates come back sorted.
+//
+// The pure methods are the minimum a backend provides. The rest have
+// generic versions built on them, which a backend overrides when it can
+// do the same work natively.
+class JobApplicationRepository {
+public:
+    virtual ~JobApplicationRepository() = default;
+
+    // Fails if the application_id is already taken.
+    virtual bool createJobApplication(const JobApplication& application) = 0;
+    virtual std::unique_ptr<JobApplication> getJobApplicationById(const std::string& applicationId) = 0;
+    virtual std::vector<std::unique_ptr<JobApplication>> getAllJobApplications() = 0;
+    virtual bool forEachJobApplication(const std::function<bool(const JobApplication&)>& callback) = 0;
+    virtual std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByCompany(const std::string& company) = 0;
+    virtual std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByStatus(ApplicationStatus status) = 0;
+    virtual std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByDateRange(const std::string& startDate,
+                                                                                      const std::string& endDate) = 0;
+
+    // Fails if the application does not exist.
+    virtual bool updateJobApplication(const JobApplication& application) = 0;
+    virtual bool updateJobApplicationStatus(const std::string& applicationId, ApplicationStatus status) = 0;
+    virtual bool addInterviewDate(const std::string& applicationId, const std::string& interviewDate) = 0;
+    virtual bool addFollowUpDate(const std::string& applicationId, const std::string& followUpDate) = 0;
+
+    virtual bool deleteJobApplication(const std::string& applicationId) = 0;
+    // Case-insensitive exact match on company.
+    virtual bool deleteJobApplicationsByCompany(const std::string& company) = 0;
+
+    virtual int getJobApplicationCount() const = 0;
+    virtual int getJobApplicationCountByStatus(ApplicationStatus status) const = 0;
+    virtual bool jobApplicationExists(const std::string& applicationId) const = 0;
+
+    // Stores each application with createJobApplication(). `batchSize` is a
+    // hint for backends that group the writes.
+    virtual BulkCreateResult createJobApplications(const std::vector<JobApplication>& applications,
+                                                   size_t batchSize);
+    // Creates the application, or updates it in place if the ID is taken.
+    virtual bool upsertJobApplication(const JobApplication& application);
+    // Filters getAllJobApplications() with JobApplicationQuery::matches().
+    virtual std::vector<std::unique_ptr<JobApplication>> findJobApplications(const JobApplicationQuery& query);
+
+    // Pages over the matching lists above. Cursors are
+    // "<date_applied>|<key>"; the key is backend-specific and callers treat
+    // the whole cursor as opaque.
+    virtual JobApplicationPage getJobApplicationsPage(size_t pageSize, const std::string& cursor);
+    virtual JobApplicationPage getJobApplicationsByCompanyPage(const std::string& company, size_t pageSize,
+                                                               const std::string& cursor);
+    virtual JobApplicationPage getJobApplicationsByStatusPage(ApplicationStatus status, size_t pageSize,
+                                                              const std::string& cursor);
+    virtual JobApplicationPage getJobApplicationsByDateRangePage(const std::string& startDate,
+                                                                 const std::string& endDate, size_t pageSize,
+                                                                 const std::string& cursor);
+
+    virtual std::map<ApplicationStatus, int> getJobApplicationCountsByStatus(
+        const std::vector<ApplicationStatus>& statuses) const;
+
+    // Header row, then one row per application in list order; dates are
+    // joined with ';'.
+    virtual bool exportToCsv(std::ostream& out);
+
+protected:
+    // False for a malformed cursor, which callers treat as an empty page.
+    static bool parseCursor(const std::string& cursor, std::string& dateApplied, std::string& key);
+    // Pages over a list ordered by (date_applied, application_id) descending.
+    static JobApplicationPage slicePage(std::vector<std::unique_ptr<JobApplication>> applications,
+                                        size_t pageSize, const std::string& cursor);
+};
+
+#endif // JOBAPPLICATIONREPOSITORY_H
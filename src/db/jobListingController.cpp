@@ -4,7 +4,42 @@
 #include <algorithm>
 #include <memory>
 
-JobListingController::JobListingController() : BaseController() {}
+JobListingController::JobListingController() : rowMapper(columnBindings()) {}
+
+JobListingController::JobListingController(std::shared_ptr<ConnectionPool> pool)
+    : DatabaseClient(pool), rowMapper(columnBindings()) {}
+
+JobListingController::JobListingController(std::shared_ptr<ConnectionRouter> router)
+    : DatabaseClient(router), rowMapper(columnBindings()) {}
+
+const RowMapper<JobListing>::Bindings& JobListingController::columnBindings() {
+    using Column = ColumnBinding<JobListing>;
+    static const RowMapper<JobListing>::Bindings bindings = {
+        Column::field<&JobListing::setJobId, &JobListing::getJobId>("job_id", COLUMN_READ | COLUMN_INSERT),
+        Column::field<&JobListing::setTitle, &JobListing::getTitle>("title"),
+        Column::field<&JobListing::setCompany, &JobListing::getCompany>("company"),
+        Column::field<&JobListing::setDescription, &JobListing::getDescription>("description"),
+        Column::field<&JobListing::setLocation, &JobListing::getLocation>("location"),
+        Column::field<&JobListing::setRemoteType, &JobListing::getRemoteType>("remote_type"),
+        Column::field<&JobListing::setJobType, &JobListing::getJobType>("job_type"),
+        Column::field<&JobListing::setExperienceLevel, &JobListing::getExperienceLevel>("experience_level"),
+        Column::field<&JobListing::setSalaryMin, &JobListing::getSalaryMin>("salary_min"),
+        Column::field<&JobListing::setSalaryMax, &JobListing::getSalaryMax>("salary_max"),
+        Column::field<&JobListing::setSalaryCurrency, &JobListing::getSalaryCurrency>("salary_currency"),
+        Column::field<&JobListing::setMinimumYearsExperience, &JobListing::getMinimumYearsExperience>("minimum_years_experience"),
+        Column::field<&JobListing::setApplicationDeadline, &JobListing::getApplicationDeadline>("application_deadline"),
+        Column::field<&JobListing::setPostedDate, &JobListing::getPostedDate>("posted_date", COLUMN_READ | COLUMN_INSERT),
+        Column::field<&JobListing::setApplicationUrl, &JobListing::getApplicationUrl>("application_url"),
+        Column::field<&JobListing::setContactEmail, &JobListing::getContactEmail>("contact_email"),
+        Column::field<&JobListing::setCompanySize, &JobListing::getCompanySize>("company_size"),
+        Column::field<&JobListing::setIndustry, &JobListing::getIndustry>("industry"),
+        Column::field<&JobListing::setCompanyWebsite, &JobListing::getCompanyWebsite>("company_website"),
+        Column::field<&JobListing::setIsActive, &JobListing::getIsActive>("is_active"),
+        Column::field<&JobListing::setDepartment, &JobListing::getDepartment>("department"),
+        Column::field<&JobListing::setReportingTo, &JobListing::getReportingTo>("reporting_to")
+    };
+    return bindings;
+}
 
 bool JobListingController::createJobListing(const JobListing& jobListing) {
     if (!initializeDatabase()) {
@@ -20,41 +55,13 @@ bool JobListingController::createJobListing(const JobListing& jobListing) {
         return false;
     }
 
-    std::string query = R"(
-        INSERT INTO job_listings (
-            job_id, title, company, description, location, remote_type, job_type,
-            experience_level, salary_min, salary_max, salary_currency,
-            minimum_years_experience, application_deadline, posted_date,
-            application_url, contact_email, company_size, industry,
-            company_website, is_active, department, reporting_to
-        ) VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, $20, $21, $22)
-        RETURNING id
-    )";
+    using Mapper = RowMapper<JobListing>;
+    static const std::string query =
+        "INSERT INTO job_listings (" + Mapper::columnList(columnBindings(), COLUMN_INSERT) +
+        ") VALUES (" + Mapper::placeholderList(columnBindings(), COLUMN_INSERT) + ") RETURNING id";
 
-    std::vector<std::string> params = {
-        jobListing.getJobId(),
-        jobListing.getTitle(),
-        jobListing.getCompany(),
-        jobListing.getDescription(),
-        jobListing.getLocation(),
-        std::to_string(static_cast<int>(jobListing.getRemoteType())),
-        std::to_string(static_cast<int>(jobListing.getJobType())),
-        std::to_string(static_cast<int>(jobListing.getExperienceLevel())),
-        std::to_string(jobListing.getSalaryMin()),
-        std::to_string(jobListing.getSalaryMax()),
-        jobListing.getSalaryCurrency(),
-        std::to_string(jobListing.getMinimumYearsExperience()),
-        jobListing.getApplicationDeadline(),
-        jobListing.getPostedDate(),
-        jobListing.getApplicationUrl(),
-        jobListing.getContactEmail(),
-        jobListing.getCompanySize(),
-        jobListing.getIndustry(),
-        jobListing.getCompanyWebsite(),
-        jobListing.getIsActive() ? "true" : "false",
-        jobListing.getDepartment(),
-        jobListing.getReportingTo()
-    };
+    std::vector<std::string> params;
+    Mapper::appendParams(columnBindings(), COLUMN_INSERT, jobListing, params);
 
     PGresult* result = db->executeParameterizedQuery(query, params);
     if (!result) {
@@ -83,14 +90,14 @@ bool JobListingController::createJobListing(const JobListing& jobListing) {
 }
 
 std::unique_ptr<JobListing> JobListingController::getJobListingById(const std::string& jobId) {
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return nullptr;
     }
 
     std::string query = "SELECT * FROM job_listings WHERE job_id = $1";
     std::vector<std::string> params = {jobId};
 
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->executeParameterizedQuery(query, params);
     if (!result) {
         return nullptr;
     }
@@ -113,14 +120,12 @@ std::unique_ptr<JobListing> JobListingController::getJobListingById(const std::s
 }
 
 std::unique_ptr<JobListing> JobListingController::getJobListingByIdInt(int id) {
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return nullptr;
     }
 
     std::string query = "SELECT * FROM job_listings WHERE id = $1";
-    std::vector<std::string> params = {std::to_string(id)};
-
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->execute(query, id);
     if (!result) {
         return nullptr;
     }
@@ -144,12 +149,12 @@ std::unique_ptr<JobListing> JobListingController::getJobListingByIdInt(int id) {
 std::vector<std::unique_ptr<JobListing>> JobListingController::getAllJobListings() {
     std::vector<std::unique_ptr<JobListing>> jobListings;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return jobListings;
     }
 
-    std::string query = "SELECT * FROM job_listings ORDER BY posted_date DESC";
-    PGresult* result = db->executeQuery(query);
+    std::string query = "SELECT * FROM job_listings ORDER BY posted_date DESC, id DESC";
+    PGresult* result = readDb->executeQuery(query);
 
     if (!result) {
         return jobListings;
@@ -170,17 +175,30 @@ std::vector<std::unique_ptr<JobListing>> JobListingController::getAllJobListings
     return jobListings;
 }
 
+bool JobListingController::forEachJobListing(const std::function<bool(const JobListing&)>& callback) {
+    if (!initializeReadDatabase()) {
+        return false;
+    }
+
+    std::string query = "SELECT * FROM job_listings ORDER BY posted_date DESC, id DESC";
+
+    return readDb->forEachRow(query, [this, &callback](DatabaseResult& row) {
+        std::unique_ptr<JobListing> jobListing(mapResultToJobListing(row));
+        return callback(*jobListing);
+    });
+}
+
 std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByCompany(const std::string& company) {
     std::vector<std::unique_ptr<JobListing>> jobListings;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return jobListings;
     }
 
-    std::string query = "SELECT * FROM job_listings WHERE LOWER(company) LIKE LOWER($1) ORDER BY posted_date DESC";
+    std::string query = "SELECT * FROM job_listings WHERE LOWER(company) LIKE LOWER($1) ORDER BY posted_date DESC, id DESC";
     std::vector<std::string> params = {"%" + company + "%"};
 
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->executeParameterizedQuery(query, params);
     if (!result) {
         return jobListings;
     }
@@ -203,14 +221,14 @@ std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByC
 std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByLocation(const std::string& location) {
     std::vector<std::unique_ptr<JobListing>> jobListings;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return jobListings;
     }
 
-    std::string query = "SELECT * FROM job_listings WHERE LOWER(location) LIKE LOWER($1) ORDER BY posted_date DESC";
+    std::string query = "SELECT * FROM job_listings WHERE LOWER(location) LIKE LOWER($1) ORDER BY posted_date DESC, id DESC";
     std::vector<std::string> params = {"%" + location + "%"};
 
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->executeParameterizedQuery(query, params);
     if (!result) {
         return jobListings;
     }
@@ -233,14 +251,12 @@ std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByL
 std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByType(JobType jobType) {
     std::vector<std::unique_ptr<JobListing>> jobListings;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return jobListings;
     }
 
-    std::string query = "SELECT * FROM job_listings WHERE job_type = $1 ORDER BY posted_date DESC";
-    std::vector<std::string> params = {std::to_string(static_cast<int>(jobType))};
-
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    std::string query = "SELECT * FROM job_listings WHERE job_type = $1 ORDER BY posted_date DESC, id DESC";
+    PGresult* result = readDb->execute(query, jobType);
     if (!result) {
         return jobListings;
     }
@@ -263,14 +279,12 @@ std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByT
 std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByExperienceLevel(JobExperienceLevel level) {
     std::vector<std::unique_ptr<JobListing>> jobListings;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return jobListings;
     }
 
-    std::string query = "SELECT * FROM job_listings WHERE experience_level = $1 ORDER BY posted_date DESC";
-    std::vector<std::string> params = {std::to_string(static_cast<int>(level))};
-
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    std::string query = "SELECT * FROM job_listings WHERE experience_level = $1 ORDER BY posted_date DESC, id DESC";
+    PGresult* result = readDb->execute(query, level);
     if (!result) {
         return jobListings;
     }
@@ -293,14 +307,12 @@ std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByE
 std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsBySalaryRange(float minSalary, float maxSalary) {
     std::vector<std::unique_ptr<JobListing>> jobListings;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return jobListings;
     }
 
-    std::string query = "SELECT * FROM job_listings WHERE salary_min >= $1 AND salary_max <= $2 ORDER BY salary_max DESC";
-    std::vector<std::string> params = {std::to_string(minSalary), std::to_string(maxSalary)};
-
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    std::string query = "SELECT * FROM job_listings WHERE salary_min >= $1 AND salary_max <= $2 ORDER BY salary_max DESC, id DESC";
+    PGresult* result = readDb->execute(query, minSalary, maxSalary);
     if (!result) {
         return jobListings;
     }
@@ -323,12 +335,12 @@ std::vector<std::unique_ptr<JobListing>> JobListingController::getJobListingsByS
 std::vector<std::unique_ptr<JobListing>> JobListingController::getActiveJobListings() {
     std::vector<std::unique_ptr<JobListing>> jobListings;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return jobListings;
     }
 
-    std::string query = "SELECT * FROM job_listings WHERE is_active = true ORDER BY posted_date DESC";
-    PGresult* result = db->executeQuery(query);
+    std::string query = "SELECT * FROM job_listings WHERE is_active = true ORDER BY posted_date DESC, id DESC";
+    PGresult* result = readDb->executeQuery(query);
 
     if (!result) {
         return jobListings;
@@ -349,6 +361,113 @@ std::vector<std::unique_ptr<JobListing>> JobListingController::getActiveJobListi
     return jobListings;
 }
 
+JobListingPage JobListingController::getJobListingsPage(size_t pageSize, const std::string& cursor) {
+    return queryPage("", {}, "posted_date", "date", pageSize, cursor);
+}
+
+JobListingPage JobListingController::getJobListingsByCompanyPage(const std::string& company, size_t pageSize,
+                                                                 const std::string& cursor) {
+    return queryPage("LOWER(company) LIKE LOWER($1)", {"%" + company + "%"}, "posted_date", "date", pageSize, cursor);
+}
+
+JobListingPage JobListingController::getJobListingsByLocationPage(const std::string& location, size_t pageSize,
+                                                                  const std::string& cursor) {
+    return queryPage("LOWER(location) LIKE LOWER($1)", {"%" + location + "%"}, "posted_date", "date", pageSize,
+                     cursor);
+}
+
+JobListingPage JobListingController::getJobListingsByTypePage(JobType jobType, size_t pageSize,
+                                                              const std::string& cursor) {
+    return queryPage("job_type = $1", {std::to_string(static_cast<int>(jobType))}, "posted_date", "date", pageSize,
+                     cursor);
+}
+
+JobListingPage JobListingController::getJobListingsByExperienceLevelPage(JobExperienceLevel level, size_t pageSize,
+                                                                         const std::string& cursor) {
+    return queryPage("experience_level = $1", {std::to_string(static_cast<int>(level))}, "posted_date", "date",
+                     pageSize, cursor);
+}
+
+JobListingPage JobListingController::getJobListingsBySalaryRangePage(float minSalary, float maxSalary,
+                                                                     size_t pageSize, const std::string& cursor) {
+    return queryPage("salary_min >= $1 AND salary_max <= $2", {std::to_string(minSalary), std::to_string(maxSalary)},
+                     "salary_max", "numeric", pageSize, cursor);
+}
+
+JobListingPage JobListingController::getActiveJobListingsPage(size_t pageSize, const std::string& cursor) {
+    return queryPage("is_active = true", {}, "posted_date", "date", pageSize, cursor);
+}
+
+// Cursors are "<sort key>|<id>", with an empty sort key for a NULL one.
+// Callers treat them as opaque.
+JobListingPage JobListingController::queryPage(const std::string& filter, std::vector<std::string> params,
+                                               const std::string& sortColumn, const std::string& sortType,
+                                               size_t pageSize, const std::string& cursor) {
+    JobListingPage page;
+    if (pageSize == 0 || !initializeReadDatabase()) {
+        return page;
+    }
+
+    std::vector<std::string> conditions;
+    if (!filter.empty()) {
+        conditions.push_back(filter);
+    }
+    if (!cursor.empty()) {
+        size_t separator = cursor.find('|');
+        std::string id = separator == std::string::npos ? "" : cursor.substr(separator + 1);
+        if (id.empty() || id.find_first_not_of("0123456789") != std::string::npos) {
+            std::cerr << "Invalid page cursor: " << cursor << std::endl;
+            return page;
+        }
+        std::string sortKey = cursor.substr(0, separator);
+        if (sortKey.empty()) {
+            // DESC puts NULLs first: what follows a NULL row is the rest of
+            // the NULLs, then every non-NULL row.
+            params.push_back(id);
+            conditions.push_back("(" + sortColumn + " IS NOT NULL OR id < $" + std::to_string(params.size()) +
+                                 "::integer)");
+        } else {
+            // A row comparison, so a (sort column, id) index seeks straight
+            // to the cursor instead of skipping over earlier pages.
+            params.push_back(sortKey);
+            params.push_back(id);
+            conditions.push_back("(" + sortColumn + ", id) < ($" + std::to_string(params.size() - 1) + "::" +
+                                 sortType + ", $" + std::to_string(params.size()) + "::integer)");
+        }
+    }
+
+    std::string query = "SELECT * FROM job_listings";
+    for (size_t i = 0; i < conditions.size(); i++) {
+        query += (i == 0 ? " WHERE " : " AND ") + conditions[i];
+    }
+    // One row past the page tells us whether another page follows.
+    params.push_back(std::to_string(pageSize + 1));
+    query += " ORDER BY " + sortColumn + " DESC, id DESC LIMIT $" + std::to_string(params.size());
+
+    PGresult* result = readDb->executeParameterizedQuery(query, params);
+    if (!result) {
+        return page;
+    }
+
+    DatabaseResult dbResult(result);
+
+    while (page.listings.size() < pageSize && dbResult.next()) {
+        JobListing* jobListing = mapResultToJobListing(dbResult);
+        if (jobListing) {
+            int jobListingId = dbResult.getInt("id");
+            jobListing->setRequiredSkills(getJobRequiredSkills(jobListingId));
+            jobListing->setPreferredSkills(getJobPreferredSkills(jobListingId));
+            page.listings.push_back(std::unique_ptr<JobListing>(jobListing));
+        }
+    }
+
+    // Decoded values, not raw bytes: with binary results those are not text.
+    if (static_cast<size_t>(dbResult.getRowCount()) > pageSize) {
+        page.nextCursor = dbResult.getString(sortColumn) + "|" + dbResult.getString("id");
+    }
+    return page;
+}
+
 bool JobListingController::updateJobListing(const JobListing& jobListing) {
     if (!initializeDatabase()) {
         return false;
@@ -363,41 +482,13 @@ bool JobListingController::updateJobListing(const JobListing& jobListing) {
         return false;
     }
 
-    std::string query = R"(
-        UPDATE job_listings SET
-            title = $2, company = $3, description = $4, location = $5,
-            remote_type = $6, job_type = $7, experience_level = $8,
-            salary_min = $9, salary_max = $10, salary_currency = $11,
-            minimum_years_experience = $12, application_deadline = $13,
-            application_url = $14, contact_email = $15, company_size = $16,
-            industry = $17, company_website = $18, is_active = $19,
-            department = $20, reporting_to = $21, updated_at = CURRENT_TIMESTAMP
-        WHERE job_id = $1
-    )";
+    using Mapper = RowMapper<JobListing>;
+    static const std::string query =
+        "UPDATE job_listings SET " + Mapper::assignmentList(columnBindings(), COLUMN_UPDATE, 2) +
+        ", updated_at = CURRENT_TIMESTAMP WHERE job_id = $1";
 
-    std::vector<std::string> params = {
-        jobListing.getJobId(),
-        jobListing.getTitle(),
-        jobListing.getCompany(),
-        jobListing.getDescription(),
-        jobListing.getLocation(),
-        std::to_string(static_cast<int>(jobListing.getRemoteType())),
-        std::to_string(static_cast<int>(jobListing.getJobType())),
-        std::to_string(static_cast<int>(jobListing.getExperienceLevel())),
-        std::to_string(jobListing.getSalaryMin()),
-        std::to_string(jobListing.getSalaryMax()),
-        jobListing.getSalaryCurrency(),
-        std::to_string(jobListing.getMinimumYearsExperience()),
-        jobListing.getApplicationDeadline(),
-        jobListing.getApplicationUrl(),
-        jobListing.getContactEmail(),
-        jobListing.getCompanySize(),
-        jobListing.getIndustry(),
-        jobListing.getCompanyWebsite(),
-        jobListing.getIsActive() ? "true" : "false",
-        jobListing.getDepartment(),
-        jobListing.getReportingTo()
-    };
+    std::vector<std::string> params = {jobListing.getJobId()};
+    Mapper::appendParams(columnBindings(), COLUMN_UPDATE, jobListing, params);
 
     bool success = db->executeParameterizedNonQuery(query, params);
 
@@ -438,9 +529,7 @@ bool JobListingController::updateJobListingSalary(const std::string& jobId, floa
     }
 
     std::string query = "UPDATE job_listings SET salary_min = $2, salary_max = $3, salary_currency = $4, updated_at = CURRENT_TIMESTAMP WHERE job_id = $1";
-    std::vector<std::string> params = {jobId, std::to_string(minSalary), std::to_string(maxSalary), currency};
-
-    return db->executeParameterizedNonQuery(query, params);
+    return db->executeNonQuery(query, jobId, minSalary, maxSalary, currency);
 }
 
 bool JobListingController::deleteJobListing(const std::string& jobId) {
@@ -488,12 +577,12 @@ bool JobListingController::deleteJobListingsByCompany(const std::string& company
 }
 
 int JobListingController::getJobListingCount() const {
-    if (!const_cast<JobListingController*>(this)->initializeDatabase()) {
+    if (!const_cast<JobListingController*>(this)->initializeReadDatabase()) {
         return 0;
     }
 
     std::string query = "SELECT COUNT(*) FROM job_listings";
-    PGresult* result = db->executeQuery(query);
+    PGresult* result = readDb->executeQuery(query);
 
     if (!result) {
         return 0;
@@ -508,12 +597,12 @@ int JobListingController::getJobListingCount() const {
 }
 
 int JobListingController::getActiveJobListingCount() const {
-    if (!const_cast<JobListingController*>(this)->initializeDatabase()) {
+    if (!const_cast<JobListingController*>(this)->initializeReadDatabase()) {
         return 0;
     }
 
     std::string query = "SELECT COUNT(*) FROM job_listings WHERE is_active = true";
-    PGresult* result = db->executeQuery(query);
+    PGresult* result = readDb->executeQuery(query);
 
     if (!result) {
         return 0;
@@ -528,14 +617,14 @@ int JobListingController::getActiveJobListingCount() const {
 }
 
 int JobListingController::getJobListingCountByCompany(const std::string& company) const {
-    if (!const_cast<JobListingController*>(this)->initializeDatabase()) {
+    if (!const_cast<JobListingController*>(this)->initializeReadDatabase()) {
         return 0;
     }
 
     std::string query = "SELECT COUNT(*) FROM job_listings WHERE LOWER(company) = LOWER($1)";
     std::vector<std::string> params = {company};
 
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->executeParameterizedQuery(query, params);
     if (!result) {
         return 0;
     }
@@ -549,47 +638,86 @@ int JobListingController::getJobListingCountByCompany(const std::string& company
 }
 
 std::string JobListingController::exportToJson() {
-    auto jobListings = getAllJobListings();
-
     std::ostringstream json;
-    json << "{\n  \"jobListings\": [\n";
+    exportToJson(json);
+    return json.str();
+}
+
+bool JobListingController::exportToJson(std::ostream& out) {
+    out << "{\n  \"jobListings\": [\n";
+
+    // The separator goes ahead of every element after the first, so the
+    // last element needs no fix-up.
+    bool first = true;
+    bool success = forEachJobListing([this, &out, &first](const JobListing& jobListing) {
+        out << (first ? "" : ",\n") << jobListingToJsonString(jobListing);
+        first = false;
+        return true;
+    });
 
-    for (size_t i = 0; i < jobListings.size(); ++i) {
-        json << jobListingToJsonString(*jobListings[i], i < jobListings.size() - 1);
+    if (!first) {
+        out << "\n";
     }
 
-    json << "  ]\n}";
-    return json.str();
+    out << "  ]\n}";
+    return success;
 }
 
 std::string JobListingController::exportToCsv() {
-    auto jobListings = getAllJobListings();
-
     std::ostringstream csv;
-    csv << "Job ID,Title,Company,Location,Remote Type,Job Type,Experience Level,";
-    csv << "Salary Min,Salary Max,Currency,Min Years Experience,Posted Date,";
-    csv << "Application Deadline,Application URL,Contact Email,Is Active\n";
-
-    for (const auto& job : jobListings) {
-        csv << escapeCsvField(job->getJobId()) << ",";
-        csv << escapeCsvField(job->getTitle()) << ",";
-        csv << escapeCsvField(job->getCompany()) << ",";
-        csv << escapeCsvField(job->getLocation()) << ",";
-        csv << escapeCsvField(JobListing::remoteTypeToString(job->getRemoteType())) << ",";
-        csv << escapeCsvField(JobListing::jobTypeToString(job->getJobType())) << ",";
-        csv << escapeCsvField(JobListing::experienceLevelToString(job->getExperienceLevel())) << ",";
-        csv << job->getSalaryMin() << ",";
-        csv << job->getSalaryMax() << ",";
-        csv << escapeCsvField(job->getSalaryCurrency()) << ",";
-        csv << job->getMinimumYearsExperience() << ",";
-        csv << escapeCsvField(job->getPostedDate()) << ",";
-        csv << escapeCsvField(job->getApplicationDeadline()) << ",";
-        csv << escapeCsvField(job->getApplicationUrl()) << ",";
-        csv << escapeCsvField(job->getContactEmail()) << ",";
-        csv << (job->getIsActive() ? "Yes" : "No") << "\n";
+    exportToCsv(csv);
+    return csv.str();
+}
+
+bool JobListingController::exportToCsv(std::ostream& out) {
+    if (!initializeReadDatabase()) {
+        return false;
     }
 
-    return csv.str();
+    // Postgres formats and quotes the CSV itself; enum labels come from
+    // JobListing so the server-side mapping cannot drift from the enums.
+    std::ostringstream remoteType, jobType, experienceLevel;
+    remoteType << "CASE remote_type";
+    for (int value = static_cast<int>(RemoteType::ON_SITE); value <= static_cast<int>(RemoteType::HYBRID); value++) {
+        remoteType << " WHEN " << value << " THEN '"
+                   << JobListing::remoteTypeToString(static_cast<RemoteType>(value)) << "'";
+    }
+    remoteType << " ELSE 'Unknown' END";
+
+    jobType << "CASE job_type";
+    for (int value = static_cast<int>(JobType::FULL_TIME); value <= static_cast<int>(JobType::FREELANCE); value++) {
+        jobType << " WHEN " << value << " THEN '"
+                << JobListing::jobTypeToString(static_cast<JobType>(value)) << "'";
+    }
+    jobType << " ELSE 'Unknown' END";
+
+    experienceLevel << "CASE experience_level";
+    for (int value = static_cast<int>(JobExperienceLevel::ENTRY_LEVEL);
+         value <= static_cast<int>(JobExperienceLevel::EXECUTIVE); value++) {
+        experienceLevel << " WHEN " << value << " THEN '"
+                        << JobListing::experienceLevelToString(static_cast<JobExperienceLevel>(value)) << "'";
+    }
+    experienceLevel << " ELSE 'Unknown' END";
+
+    std::string query = R"(
+        COPY (
+            SELECT job_id AS "Job ID", title AS "Title", company AS "Company", location AS "Location",
+                   )" + remoteType.str() + R"( AS "Remote Type",
+                   )" + jobType.str() + R"( AS "Job Type",
+                   )" + experienceLevel.str() + R"( AS "Experience Level",
+                   COALESCE(salary_min, 0)::float8 AS "Salary Min",
+                   COALESCE(salary_max, 0)::float8 AS "Salary Max",
+                   salary_currency AS "Currency",
+                   COALESCE(minimum_years_experience, 0) AS "Min Years Experience",
+                   posted_date AS "Posted Date", application_deadline AS "Application Deadline",
+                   application_url AS "Application URL", contact_email AS "Contact Email",
+                   CASE WHEN is_active THEN 'Yes' ELSE 'No' END AS "Is Active"
+            FROM job_listings
+            ORDER BY posted_date DESC, id DESC
+        ) TO STDOUT WITH (FORMAT csv, HEADER)
+    )";
+
+    return readDb->copyOut(query, out);
 }
 
 bool JobListingController::importFromJson(const std::string& jsonData) {
@@ -623,28 +751,7 @@ bool JobListingController::jobListingExists(const std::string& jobId) const {
 
 JobListing* JobListingController::mapResultToJobListing(DatabaseResult& result) {
     JobListing* jobListing = new JobListing();
-
-    jobListing->setJobId(result.getString("job_id"));
-    jobListing->setTitle(result.getString("title"));
-    jobListing->setCompany(result.getString("company"));
-    jobListing->setDescription(result.getString("description"));
-    jobListing->setLocation(result.getString("location"));
-    jobListing->setRemoteType(static_cast<RemoteType>(result.getInt("remote_type")));
-    jobListing->setJobType(static_cast<JobType>(result.getInt("job_type")));
-    jobListing->setExperienceLevel(static_cast<JobExperienceLevel>(result.getInt("experience_level")));
-    jobListing->setSalaryRange(result.getDouble("salary_min"), result.getDouble("salary_max"), result.getString("salary_currency"));
-    jobListing->setMinimumYearsExperience(result.getInt("minimum_years_experience"));
-    jobListing->setApplicationDeadline(result.getString("application_deadline"));
-    jobListing->setPostedDate(result.getString("posted_date"));
-    jobListing->setApplicationUrl(result.getString("application_url"));
-    jobListing->setContactEmail(result.getString("contact_email"));
-    jobListing->setCompanySize(result.getString("company_size"));
-    jobListing->setIndustry(result.getString("industry"));
-    jobListing->setCompanyWebsite(result.getString("company_website"));
-    jobListing->setIsActive(result.getBool("is_active"));
-    jobListing->setDepartment(result.getString("department"));
-    jobListing->setReportingTo(result.getString("reporting_to"));
-
+    rowMapper.map(result, *jobListing);
     return jobListing;
 }
 
@@ -658,14 +765,12 @@ bool JobListingController::insertJobPreferredSkills(int jobListingId, const Skil
 
 bool JobListingController::deleteJobRequiredSkills(int jobListingId) {
     std::string query = "DELETE FROM job_required_skills WHERE job_listing_id = $1";
-    std::vector<std::string> params = {std::to_string(jobListingId)};
-    return db->executeParameterizedNonQuery(query, params);
+    return db->executeNonQuery(query, jobListingId);
 }
 
 bool JobListingController::deleteJobPreferredSkills(int jobListingId) {
     std::string query = "DELETE FROM job_preferred_skills WHERE job_listing_id = $1";
-    std::vector<std::string> params = {std::to_string(jobListingId)};
-    return db->executeParameterizedNonQuery(query, params);
+    return db->executeNonQuery(query, jobListingId);
 }
 
 Skills JobListingController::getJobRequiredSkills(int jobListingId) {
@@ -678,7 +783,7 @@ Skills JobListingController::getJobPreferredSkills(int jobListingId) {
     return skills;
 }
 
-std::string JobListingController::jobListingToJsonString(const JobListing& jobListing, bool includeComma) {
+std::string JobListingController::jobListingToJsonString(const JobListing& jobListing) {
     std::ostringstream json;
 
     json << "    {\n";
@@ -705,8 +810,6 @@ std::string JobListingController::jobListingToJsonString(const JobListing& jobLi
     json << "      \"department\": \"" << escapeJsonString(jobListing.getDepartment()) << "\",\n";
     json << "      \"reportingTo\": \"" << escapeJsonString(jobListing.getReportingTo()) << "\"\n";
     json << "    }";
-    if (includeComma) json << ",";
-    json << "\n";
 
     return json.str();
 }
\ No newline at end of file
@@ -2,19 +2,38 @@
 #define JOBLISTINGCONTROLLER_H
 
 #include "baseController.h"
+#include "rowMapper.h"
 #include "../ds/resume/jobListing.h"
 #include <vector>
 #include <memory>
+#include <functional>
+#include <ostream>
+
+// One page of a keyset-paginated listing. Pass nextCursor back to fetch the
+// following page; it is empty once there is nothing after this one.
+struct JobListingPage {
+    std::vector<std::unique_ptr<JobListing>> listings;
+    std::string nextCursor;
+};
+
+class JobListingController : public BaseController, public DatabaseClient {
+private:
+    RowMapper<JobListing> rowMapper;
 
-class JobListingController : public BaseController {
 public:
     JobListingController();
+    explicit JobListingController(std::shared_ptr<ConnectionPool> pool);
+    explicit JobListingController(std::shared_ptr<ConnectionRouter> router);
     ~JobListingController() = default;
 
+    // Column <-> member bindings for the table this controller owns.
+    static const RowMapper<JobListing>::Bindings& columnBindings();
+
     bool createJobListing(const JobListing& jobListing);
     std::unique_ptr<JobListing> getJobListingById(const std::string& jobId);
     std::unique_ptr<JobListing> getJobListingByIdInt(int id);
     std::vector<std::unique_ptr<JobListing>> getAllJobListings();
+    bool forEachJobListing(const std::function<bool(const JobListing&)>& callback);
     std::vector<std::unique_ptr<JobListing>> getJobListingsByCompany(const std::string& company);
     std::vector<std::unique_ptr<JobListing>> getJobListingsByLocation(const std::string& location);
     std::vector<std::unique_ptr<JobListing>> getJobListingsByType(JobType jobType);
@@ -22,6 +41,20 @@ public:
     std::vector<std::unique_ptr<JobListing>> getJobListingsBySalaryRange(float minSalary, float maxSalary);
     std::vector<std::unique_ptr<JobListing>> getActiveJobListings();
 
+    // Paginated variants of the lists above, same order. Each page seeks
+    // straight to its cursor, so deep pages cost the same as the first.
+    JobListingPage getJobListingsPage(size_t pageSize, const std::string& cursor = "");
+    JobListingPage getJobListingsByCompanyPage(const std::string& company, size_t pageSize,
+                                               const std::string& cursor = "");
+    JobListingPage getJobListingsByLocationPage(const std::string& location, size_t pageSize,
+                                                const std::string& cursor = "");
+    JobListingPage getJobListingsByTypePage(JobType jobType, size_t pageSize, const std::string& cursor = "");
+    JobListingPage getJobListingsByExperienceLevelPage(JobExperienceLevel level, size_t pageSize,
+                                                       const std::string& cursor = "");
+    JobListingPage getJobListingsBySalaryRangePage(float minSalary, float maxSalary, size_t pageSize,
+                                                   const std::string& cursor = "");
+    JobListingPage getActiveJobListingsPage(size_t pageSize, const std::string& cursor = "");
+
     bool updateJobListing(const JobListing& jobListing);
     bool updateJobListingStatus(const std::string& jobId, bool isActive);
     bool updateJobListingSalary(const std::string& jobId, float minSalary, float maxSalary, const std::string& currency);
@@ -35,6 +68,8 @@ public:
 
     std::string exportToJson() override;
     std::string exportToCsv() override;
+    bool exportToJson(std::ostream& out);
+    bool exportToCsv(std::ostream& out);
     bool importFromJson(const std::string& jsonData) override;
     bool importFromCsv(const std::string& csvData);
 
@@ -42,13 +77,17 @@ public:
 
 private:
     JobListing* mapResultToJobListing(DatabaseResult& result);
+    // Pages ordered by `sortColumn` DESC, id DESC; `sortType` is the
+    // column's SQL type, used to cast the cursor's sort key.
+    JobListingPage queryPage(const std::string& filter, std::vector<std::string> params, const std::string& sortColumn,
+                             const std::string& sortType, size_t pageSize, const std::string& cursor);
     bool insertJobRequiredSkills(int jobListingId, const Skills& skills);
     bool insertJobPreferredSkills(int jobListingId, const Skills& skills);
     bool deleteJobRequiredSkills(int jobListingId);
     bool deleteJobPreferredSkills(int jobListingId);
     Skills getJobRequiredSkills(int jobListingId);
     Skills getJobPreferredSkills(int jobListingId);
-    std::string jobListingToJsonString(const JobListing& jobListing, bool includeComma = true);
+    std::string jobListingToJsonString(const JobListing& jobListing);
 };
 
 #endif // JOBLISTINGCONTROLLER_H
\ No newline at end of file
@@ -0,0 +1,290 @@
+#include "memoryJobApplicationRepository.h"
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <mutex>
+
+void InMemoryJobApplicationRepository::index(const JobApplication& application) {
+    const std::string id = application.getApplicationId();
+    byDate.emplace(application.getDateApplied(), id);
+    byStatus.emplace(application.getStatus(), application.getDateApplied(), id);
+    statusCounts[application.getStatus()]++;
+    if (!application.getJobId().empty()) {
+        byJobId[application.getJobId()].insert(id);
+    }
+}
+
+void InMemoryJobApplicationRepository::unindex(const JobApplication& application) {
+    const std::string id = application.getApplicationId();
+    byDate.erase(DateKey(application.getDateApplied(), id));
+    byStatus.erase(StatusKey(application.getStatus(), application.getDateApplied(), id));
+    statusCounts[application.getStatus()]--;
+
+    auto jobApplications = byJobId.find(application.getJobId());
+    if (jobApplications != byJobId.end()) {
+        jobApplications->second.erase(id);
+        if (jobApplications->second.empty()) {
+            byJobId.erase(jobApplications);
+        }
+    }
+}
+
+void InMemoryJobApplicationRepository::insert(JobApplication application) {
+    // The SQL backends return child dates ordered; store them that way.
+    std::vector<std::string> interviewDates = application.getInterviewDates();
+    std::vector<std::string> followUpDates = application.getFollowUpDates();
+    std::sort(interviewDates.begin(), interviewDates.end());
+    std::sort(followUpDates.begin(), followUpDates.end());
+    application.clearInterviewDates();
+    application.clearFollowUpDates();
+    for (const auto& date : interviewDates) {
+        application.addInterviewDate(date);
+    }
+    for (const auto& date : followUpDates) {
+        application.addFollowUpDate(date);
+    }
+
+    index(application);
+    std::string id = application.getApplicationId();
+    applications.emplace(std::move(id), std::move(application));
+}
+
+void InMemoryJobApplicationRepository::erase(std::unordered_map<std::string, JobApplication>::iterator it) {
+    unindex(it->second);
+    applications.erase(it);
+}
+
+std::unique_ptr<JobApplication> InMemoryJobApplicationRepository::copyOf(const std::string& applicationId) const {
+    auto it = applications.find(applicationId);
+    if (it == applications.end()) {
+        return nullptr;
+    }
+    return std::unique_ptr<JobApplication>(new JobApplication(it->second));
+}
+
+void InMemoryJobApplicationRepository::insertSorted(std::vector<std::string>& dates, const std::string& date) {
+    dates.insert(std::upper_bound(dates.begin(), dates.end(), date), date);
+}
+
+std::string InMemoryJobApplicationRepository::toLower(const std::string& value) {
+    std::string lower = value;
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower;
+}
+
+bool InMemoryJobApplicationRepository::createJobApplication(const JobApplication& application) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if (applications.count(application.getApplicationId())) {
+        std::cerr << "Job application with ID " << application.getApplicationId() << " already exists" << std::endl;
+        return false;
+    }
+
+    insert(application);
+    return true;
+}
+
+std::unique_ptr<JobApplication> InMemoryJobApplicationRepository::getJobApplicationById(const std::string& applicationId) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return copyOf(applicationId);
+}
+
+std::vector<std::unique_ptr<JobApplication>> InMemoryJobApplicationRepository::getAllJobApplications() {
+    std::vector<std::unique_ptr<JobApplication>> result;
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    result.reserve(applications.size());
+    for (auto it = byDate.rbegin(); it != byDate.rend(); ++it) {
+        result.push_back(copyOf(it->second));
+    }
+    return result;
+}
+
+bool InMemoryJobApplicationRepository::forEachJobApplication(
+        const std::function<bool(const JobApplication&)>& callback) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    for (auto it = byDate.rbegin(); it != byDate.rend(); ++it) {
+        if (!callback(applications.at(it->second))) {
+            break;
+        }
+    }
+    return true;
+}
+
+std::vector<std::unique_ptr<JobApplication>> InMemoryJobApplicationRepository::getJobApplicationsByCompany(
+        const std::string& company) {
+    std::vector<std::unique_ptr<JobApplication>> result;
+    std::string needle = toLower(company);
+
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    for (auto it = byDate.rbegin(); it != byDate.rend(); ++it) {
+        const JobApplication& application = applications.at(it->second);
+        if (toLower(application.getCompany()).find(needle) != std::string::npos) {
+            result.push_back(std::unique_ptr<JobApplication>(new JobApplication(application)));
+        }
+    }
+    return result;
+}
+
+std::vector<std::unique_ptr<JobApplication>> InMemoryJobApplicationRepository::getJobApplicationsByStatus(
+        ApplicationStatus status) {
+    std::vector<std::unique_ptr<JobApplication>> result;
+    std::shared_lock<std::shared_mutex> lock(mutex);
+
+    auto first = byStatus.lower_bound(StatusKey(status, std::string(), std::string()));
+    auto last = first;
+    while (last != byStatus.end() && std::get<0>(*last) == status) {
+        ++last;
+    }
+    for (auto it = std::make_reverse_iterator(last); it != std::make_reverse_iterator(first); ++it) {
+        result.push_back(copyOf(std::get<2>(*it)));
+    }
+    return result;
+}
+
+std::vector<std::unique_ptr<JobApplication>> InMemoryJobApplicationRepository::getJobApplicationsByDateRange(
+        const std::string& startDate, const std::string& endDate) {
+    std::vector<std::unique_ptr<JobApplication>> result;
+    if (startDate > endDate) {
+        return result;
+    }
+
+    // end + '\0' is the smallest string after `endDate`, so the range is inclusive.
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto first = byDate.lower_bound(DateKey(startDate, std::string()));
+    auto last = byDate.lower_bound(DateKey(endDate + std::string(1, '\0'), std::string()));
+    for (auto it = std::make_reverse_iterator(last); it != std::make_reverse_iterator(first); ++it) {
+        result.push_back(copyOf(it->second));
+    }
+    return result;
+}
+
+std::vector<std::unique_ptr<JobApplication>> InMemoryJobApplicationRepository::getJobApplicationsByJobId(
+        const std::string& jobId) {
+    std::vector<std::unique_ptr<JobApplication>> result;
+    std::shared_lock<std::shared_mutex> lock(mutex);
+
+    auto ids = byJobId.find(jobId);
+    if (ids == byJobId.end()) {
+        return result;
+    }
+    for (const auto& id : ids->second) {
+        result.push_back(copyOf(id));
+    }
+    std::sort(result.begin(), result.end(),
+              [](const std::unique_ptr<JobApplication>& a, const std::unique_ptr<JobApplication>& b) {
+                  return a->getDateApplied() > b->getDateApplied();
+              });
+    return result;
+}
+
+bool InMemoryJobApplicationRepository::updateJobApplication(const JobApplication& application) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = applications.find(application.getApplicationId());
+    if (it == applications.end()) {
+        std::cerr << "Job application with ID " << application.getApplicationId() << " does not exist" << std::endl;
+        return false;
+    }
+
+    erase(it);
+    insert(application);
+    return true;
+}
+
+bool InMemoryJobApplicationRepository::updateJobApplicationStatus(const std::string& applicationId,
+                                                                  ApplicationStatus status) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = applications.find(applicationId);
+    if (it == applications.end()) {
+        // Matches an UPDATE that touches no rows.
+        return true;
+    }
+
+    unindex(it->second);
+    it->second.setStatus(status);
+    index(it->second);
+    return true;
+}
+
+bool InMemoryJobApplicationRepository::addInterviewDate(const std::string& applicationId,
+                                                        const std::string& interviewDate) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = applications.find(applicationId);
+    if (it == applications.end()) {
+        std::cerr << "Job application with ID " << applicationId << " does not exist" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> dates = it->second.getInterviewDates();
+    insertSorted(dates, interviewDate);
+    it->second.clearInterviewDates();
+    for (const auto& date : dates) {
+        it->second.addInterviewDate(date);
+    }
+    return true;
+}
+
+bool InMemoryJobApplicationRepository::addFollowUpDate(const std::string& applicationId,
+                                                       const std::string& followUpDate) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = applications.find(applicationId);
+    if (it == applications.end()) {
+        std::cerr << "Job application with ID " << applicationId << " does not exist" << std::endl;
+        return false;
+    }
+
+    std::vector<std::string> dates = it->second.getFollowUpDates();
+    insertSorted(dates, followUpDate);
+    it->second.clearFollowUpDates();
+    for (const auto& date : dates) {
+        it->second.addFollowUpDate(date);
+    }
+    return true;
+}
+
+bool InMemoryJobApplicationRepository::deleteJobApplication(const std::string& applicationId) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = applications.find(applicationId);
+    if (it != applications.end()) {
+        erase(it);
+    }
+    return true;
+}
+
+bool InMemoryJobApplicationRepository::deleteJobApplicationsByCompany(const std::string& company) {
+    std::string lower = toLower(company);
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    for (auto it = applications.begin(); it != applications.end();) {
+        auto next = std::next(it);
+        if (toLower(it->second.getCompany()) == lower) {
+            erase(it);
+        }
+        it = next;
+    }
+    return true;
+}
+
+int InMemoryJobApplicationRepository::getJobApplicationCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return static_cast<int>(applications.size());
+}
+
+int InMemoryJobApplicationRepository::getJobApplicationCountByStatus(ApplicationStatus status) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto count = statusCounts.find(status);
+    return count == statusCounts.end() ? 0 : count->second;
+}
+
+bool InMemoryJobApplicationRepository::jobApplicationExists(const std::string& applicationId) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return applications.count(applicationId) > 0;
+}
+
+void InMemoryJobApplicationRepository::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    applications.clear();
+    byJobId.clear();
+    byDate.clear();
+    byStatus.clear();
+    statusCounts.clear();
+}
@@ -0,0 +1,67 @@
+#ifndef MEMORYJOBAPPLICATIONREPOSITORY_H
+#define MEMORYJOBAPPLICATIONREPOSITORY_H
+
+#include "jobApplicationRepository.h"
+#include <map>
+#include <set>
+#include <shared_mutex>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+// Job applications held in process memory, for tests, benchmarks and
+// deployments whose data fits in RAM. Hash indexes on application_id and
+// job_id; ordered indexes on date_applied and (status, date_applied), so
+// lookups, status filters and date ranges never scan the whole set.
+// Safe to share between threads. forEachJobApplication() holds a read lock
+// while it runs, so its callback must not write to the repository.
+class InMemoryJobApplicationRepository : public JobApplicationRepository {
+private:
+    using DateKey = std::pair<std::string, std::string>;
+    using StatusKey = std::tuple<ApplicationStatus, std::string, std::string>;
+
+    std::unordered_map<std::string, JobApplication> applications;
+    std::unordered_map<std::string, std::unordered_set<std::string>> byJobId;
+    std::set<DateKey> byDate;
+    std::set<StatusKey> byStatus;
+    std::map<ApplicationStatus, int> statusCounts;
+    mutable std::shared_mutex mutex;
+
+    void index(const JobApplication& application);
+    void unindex(const JobApplication& application);
+    void insert(JobApplication application);
+    void erase(std::unordered_map<std::string, JobApplication>::iterator it);
+    std::unique_ptr<JobApplication> copyOf(const std::string& applicationId) const;
+    static void insertSorted(std::vector<std::string>& dates, const std::string& date);
+    static std::string toLower(const std::string& value);
+
+public:
+    InMemoryJobApplicationRepository() = default;
+
+    bool createJobApplication(const JobApplication& application) override;
+    std::unique_ptr<JobApplication> getJobApplicationById(const std::string& applicationId) override;
+    std::vector<std::unique_ptr<JobApplication>> getAllJobApplications() override;
+    bool forEachJobApplication(const std::function<bool(const JobApplication&)>& callback) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByCompany(const std::string& company) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByStatus(ApplicationStatus status) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByDateRange(const std::string& startDate,
+                                                                              const std::string& endDate) override;
+    // Applications for one job listing, newest first.
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByJobId(const std::string& jobId);
+
+    bool updateJobApplication(const JobApplication& application) override;
+    bool updateJobApplicationStatus(const std::string& applicationId, ApplicationStatus status) override;
+    bool addInterviewDate(const std::string& applicationId, const std::string& interviewDate) override;
+    bool addFollowUpDate(const std::string& applicationId, const std::string& followUpDate) override;
+
+    bool deleteJobApplication(const std::string& applicationId) override;
+    bool deleteJobApplicationsByCompany(const std::string& company) override;
+
+    int getJobApplicationCount() const override;
+    int getJobApplicationCountByStatus(ApplicationStatus status) const override;
+    bool jobApplicationExists(const std::string& applicationId) const override;
+
+    void clear();
+};
+
+#endif // MEMORYJOBAPPLICATIONREPOSITORY_H
@@ -0,0 +1,838 @@
+#include "postgresJobApplicationRepository.h"
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+PostgresJobApplicationRepository::PostgresJobApplicationRepository(std::shared_ptr<ConnectionRouter> router)
+    : DatabaseClient(router), rowMapper(columnBindings()) {}
+
+const RowMapper<JobApplication>::Bindings& PostgresJobApplicationRepository::columnBindings() {
+    using Column = ColumnBinding<JobApplication>;
+    static const RowMapper<JobApplication>::Bindings bindings = {
+        Column::field<&JobApplication::setApplicationId, &JobApplication::getApplicationId>(
+            "application_id", COLUMN_READ | COLUMN_INSERT),
+        Column::field<&JobApplication::setJobId, &JobApplication::getJobId>("job_id"),
+        Column::field<&JobApplication::setJobTitle, &JobApplication::getJobTitle>("job_title"),
+        Column::field<&JobApplication::setCompany, &JobApplication::getCompany>("company"),
+        Column::field<&JobApplication::setDateApplied, &JobApplication::getDateApplied>("date_applied"),
+        Column::field<&JobApplication::setStatus, &JobApplication::getStatus>("status"),
+        Column::field<&JobApplication::setContactName, &JobApplication::getContactName>("contact_name"),
+        Column::field<&JobApplication::setContactEmail, &JobApplication::getContactEmail>("contact_email"),
+        Column::field<&JobApplication::setContactPhone, &JobApplication::getContactPhone>("contact_phone"),
+        Column::field<&JobApplication::setComments, &JobApplication::getComments>("comments"),
+        Column::field<&JobApplication::setApplicationUrl, &JobApplication::getApplicationUrl>("application_url"),
+        Column::field<&JobApplication::setSalaryOffered, &JobApplication::getSalaryOffered>("salary_offered"),
+        Column::field<&JobApplication::setExpectedSalary, &JobApplication::getExpectedSalary>("expected_salary"),
+        Column::field<&JobApplication::setResponseDeadline, &JobApplication::getResponseDeadline>("response_deadline"),
+        Column::field<&JobApplication::setReferralSource, &JobApplication::getReferralSource>("referral_source"),
+        Column::field<&JobApplication::setApplicationMethod, &JobApplication::getApplicationMethod>("application_method"),
+        Column::field<&JobApplication::setNotes, &JobApplication::getNotes>("notes")
+    };
+    return bindings;
+}
+
+bool PostgresJobApplicationRepository::createJobApplication(const JobApplication& application) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    if (jobApplicationExists(application.getApplicationId())) {
+        std::cerr << "Job application with ID " << application.getApplicationId() << " already exists" << std::endl;
+        return false;
+    }
+
+    using Mapper = RowMapper<JobApplication>;
+    static const std::string query =
+        "INSERT INTO job_applications (" + Mapper::columnList(columnBindings(), COLUMN_INSERT) +
+        ") VALUES (" + Mapper::placeholderList(columnBindings(), COLUMN_INSERT) + ")";
+
+    std::vector<std::string> params;
+    Mapper::appendParams(columnBindings(), COLUMN_INSERT, application, params);
+
+    DatabaseConnection::Batch batch(*db);
+    batch.add(query, params);
+    queueInterviewDateInserts(batch, application.getApplicationId(), application.getInterviewDates());
+    queueFollowUpDateInserts(batch, application.getApplicationId(), application.getFollowUpDates());
+
+    return batch.execute();
+}
+
+BulkCreateResult PostgresJobApplicationRepository::createJobApplications(const std::vector<JobApplication>& applications,
+                                                                          size_t batchSize) {
+    BulkCreateResult outcome;
+    if (!initializeDatabase()) {
+        for (size_t i = 0; i < applications.size(); i++) {
+            outcome.failures.emplace_back(i, "no database connection");
+        }
+        return outcome;
+    }
+
+    // Turn away up front what would otherwise fail a whole COPY: missing
+    // NOT NULL columns and IDs repeated within the input.
+    std::vector<size_t> candidates;
+    std::unordered_set<std::string> seen;
+    for (size_t i = 0; i < applications.size(); i++) {
+        const JobApplication& app = applications[i];
+        if (app.getApplicationId().empty() || app.getJobTitle().empty() || app.getCompany().empty() ||
+            app.getDateApplied().empty()) {
+            outcome.failures.emplace_back(i, "missing application ID, job title, company or date applied");
+        } else if (!seen.insert(app.getApplicationId()).second) {
+            outcome.failures.emplace_back(i, "duplicate application ID in input");
+        } else {
+            candidates.push_back(i);
+        }
+    }
+
+    if (batchSize == 0) {
+        batchSize = candidates.size();
+    }
+    for (size_t start = 0; start < candidates.size(); start += batchSize) {
+        auto end = candidates.begin() + std::min(start + batchSize, candidates.size());
+        createJobApplicationBatch(applications, std::vector<size_t>(candidates.begin() + start, end), outcome);
+    }
+
+    std::sort(outcome.failures.begin(), outcome.failures.end());
+    return outcome;
+}
+
+void PostgresJobApplicationRepository::createJobApplicationBatch(const std::vector<JobApplication>& applications,
+                                                                 const std::vector<size_t>& indexes,
+                                                                 BulkCreateResult& outcome) {
+    std::vector<std::string> applicationIds;
+    for (size_t index : indexes) {
+        applicationIds.push_back(applications[index].getApplicationId());
+    }
+
+    PGresult* result = db->executeParameterizedQuery(
+        "SELECT application_id FROM job_applications WHERE application_id = ANY($1::text[])",
+        {toArrayLiteral(applicationIds)});
+    if (!result) {
+        for (size_t index : indexes) {
+            outcome.failures.emplace_back(index, db->getLastError());
+        }
+        return;
+    }
+
+    std::unordered_set<std::string> existing;
+    DatabaseResult found(result);
+    while (found.next()) {
+        existing.insert(found.getString(0));
+    }
+
+    std::vector<size_t> pending;
+    for (size_t index : indexes) {
+        if (existing.count(applications[index].getApplicationId())) {
+            outcome.failures.emplace_back(index, "already exists");
+        } else {
+            pending.push_back(index);
+        }
+    }
+
+    std::string error;
+    if (pending.empty() || copyJobApplications(applications, pending, error)) {
+        outcome.created += pending.size();
+        return;
+    }
+
+    // COPY is all-or-nothing, so one bad row (an unknown job_id, say) sank
+    // the batch. Load the rows one at a time to find and report it.
+    for (size_t index : pending) {
+        error.clear();
+        if (copyJobApplications(applications, {index}, error)) {
+            outcome.created++;
+        } else {
+            outcome.failures.emplace_back(index, error);
+        }
+    }
+}
+
+bool PostgresJobApplicationRepository::copyJobApplications(const std::vector<JobApplication>& applications,
+                                                           const std::vector<size_t>& indexes, std::string& error) {
+    using Mapper = RowMapper<JobApplication>;
+    static const std::vector<std::string> columns = [] {
+        std::vector<std::string> names;
+        for (const auto& binding : columnBindings()) {
+            if (binding.usage & COLUMN_INSERT) {
+                names.push_back(binding.column);
+            }
+        }
+        return names;
+    }();
+
+    if (!db->beginTransaction()) {
+        error = db->getLastError();
+        return false;
+    }
+
+    bool success;
+    {
+        DatabaseConnection::CopyWriter copy(*db);
+        success = copy.begin("job_applications", columns);
+        std::vector<std::string> values;
+        for (size_t i = 0; success && i < indexes.size(); i++) {
+            values.clear();
+            Mapper::appendParams(columnBindings(), COLUMN_INSERT, applications[indexes[i]], values);
+            // Unset optional fields go in as NULL: '' is not a valid date
+            // and would not match any job listing.
+            for (const auto& value : values) {
+                if (value.empty()) {
+                    copy.addNull();
+                } else {
+                    copy.addField(value);
+                }
+            }
+            success = copy.endRow();
+        }
+        success = success && copy.finish();
+        if (!success) {
+            error = copy.getError();
+        }
+    }
+
+    success = success &&
+              copyDates("interview_dates", "interview_date", &JobApplication::getInterviewDates,
+                        applications, indexes, error) &&
+              copyDates("followup_dates", "followup_date", &JobApplication::getFollowUpDates,
+                        applications, indexes, error);
+    if (!success) {
+        db->rollbackTransaction();
+        return false;
+    }
+    return db->commitTransaction();
+}
+
+bool PostgresJobApplicationRepository::copyDates(const char* table, const char* column,
+                                                 std::vector<std::string> (JobApplication::*dates)() const,
+                                                 const std::vector<JobApplication>& applications,
+                                                 const std::vector<size_t>& indexes, std::string& error) {
+    bool any = false;
+    for (size_t index : indexes) {
+        if (!(applications[index].*dates)().empty()) {
+            any = true;
+            break;
+        }
+    }
+    if (!any) {
+        return true;
+    }
+
+    DatabaseConnection::CopyWriter copy(*db);
+    bool success = copy.begin(table, {"application_id", column});
+    for (size_t i = 0; success && i < indexes.size(); i++) {
+        const JobApplication& app = applications[indexes[i]];
+        for (const auto& date : (app.*dates)()) {
+            if (!copy.writeRow({app.getApplicationId(), date})) {
+                success = false;
+                break;
+            }
+        }
+    }
+    success = success && copy.finish();
+    if (!success) {
+        error = copy.getError();
+    }
+    return success;
+}
+
+std::unique_ptr<JobApplication> PostgresJobApplicationRepository::getJobApplicationById(const std::string& applicationId) {
+    if (!initializeReadDatabase()) {
+        return nullptr;
+    }
+
+    std::string query = "SELECT * FROM job_applications WHERE application_id = $1";
+    std::vector<std::string> params = {applicationId};
+
+    // The parent row and both date lists go out together in one flight.
+    std::future<DatabaseResult> applicationResult = readDb->executeAsync(query, params);
+    std::future<DatabaseResult> interviewResult = readDb->executeAsync(
+        "SELECT interview_date FROM interview_dates WHERE application_id = $1 ORDER BY interview_date", params);
+    std::future<DatabaseResult> followUpResult = readDb->executeAsync(
+        "SELECT followup_date FROM followup_dates WHERE application_id = $1 ORDER BY followup_date", params);
+    readDb->waitForAsync();
+
+    DatabaseResult dbResult = applicationResult.get();
+    DatabaseResult interviewDates = interviewResult.get();
+    DatabaseResult followUpDates = followUpResult.get();
+
+    if (!dbResult.isValid() || dbResult.getRowCount() == 0) {
+        return nullptr;
+    }
+
+    dbResult.next();
+    JobApplication* app = mapResultToJobApplication(dbResult);
+
+    if (app) {
+        while (interviewDates.next()) {
+            app->addInterviewDate(interviewDates.getString(0));
+        }
+
+        while (followUpDates.next()) {
+            app->addFollowUpDate(followUpDates.getString(0));
+        }
+    }
+
+    return std::unique_ptr<JobApplication>(app);
+}
+
+std::vector<std::unique_ptr<JobApplication>> PostgresJobApplicationRepository::getAllJobApplications() {
+    std::vector<std::unique_ptr<JobApplication>> applications;
+
+    if (!initializeReadDatabase()) {
+        return applications;
+    }
+
+    std::string query = "SELECT * FROM job_applications ORDER BY date_applied DESC, id DESC";
+    return loadJobApplications(readDb->executeQuery(query));
+}
+
+bool PostgresJobApplicationRepository::forEachJobApplication(const std::function<bool(const JobApplication&)>& callback) {
+    if (!initializeReadDatabase()) {
+        return false;
+    }
+
+    // Child dates are folded into each row server-side: the connection is
+    // busy streaming, so no per-row follow-up queries are possible.
+    std::string query = R"(
+        SELECT ja.*,
+            array_to_string(ARRAY(SELECT interview_date FROM interview_dates i
+                                  WHERE i.application_id = ja.application_id
+                                  ORDER BY interview_date), ',') AS interview_date_list,
+            array_to_string(ARRAY(SELECT followup_date FROM followup_dates f
+                                  WHERE f.application_id = ja.application_id
+                                  ORDER BY followup_date), ',') AS followup_date_list
+        FROM job_applications ja
+        ORDER BY ja.date_applied DESC, ja.id DESC
+    )";
+
+    return readDb->forEachRow(query, [this, &callback](DatabaseResult& row) {
+        std::unique_ptr<JobApplication> app(mapResultToJobApplication(row));
+
+        for (const auto& date : splitDateList(row.getString("interview_date_list"))) {
+            app->addInterviewDate(date);
+        }
+
+        for (const auto& date : splitDateList(row.getString("followup_date_list"))) {
+            app->addFollowUpDate(date);
+        }
+
+        return callback(*app);
+    });
+}
+
+std::vector<std::unique_ptr<JobApplication>> PostgresJobApplicationRepository::getJobApplicationsByCompany(const std::string& company) {
+    std::vector<std::unique_ptr<JobApplication>> applications;
+
+    if (!initializeReadDatabase()) {
+        return applications;
+    }
+
+    std::string query = "SELECT * FROM job_applications WHERE LOWER(company) LIKE LOWER($1) ORDER BY date_applied DESC, id DESC";
+    std::vector<std::string> params = {"%" + company + "%"};
+
+    return loadJobApplications(readDb->executeParameterizedQuery(query, params));
+}
+
+std::vector<std::unique_ptr<JobApplication>> PostgresJobApplicationRepository::getJobApplicationsByStatus(ApplicationStatus status) {
+    std::vector<std::unique_ptr<JobApplication>> applications;
+
+    if (!initializeReadDatabase()) {
+        return applications;
+    }
+
+    std::string query = "SELECT * FROM job_applications WHERE status = $1 ORDER BY date_applied DESC, id DESC";
+    return loadJobApplications(readDb->execute(query, status));
+}
+
+std::vector<std::unique_ptr<JobApplication>> PostgresJobApplicationRepository::getJobApplicationsByDateRange(const std::string& startDate, const std::string& endDate) {
+    std::vector<std::unique_ptr<JobApplication>> applications;
+
+    if (!initializeReadDatabase()) {
+        return applications;
+    }
+
+    std::string query = "SELECT * FROM job_applications WHERE date_applied BETWEEN $1 AND $2 ORDER BY date_applied DESC, id DESC";
+    std::vector<std::string> params = {startDate, endDate};
+
+    return loadJobApplications(readDb->executeParameterizedQuery(query, params));
+}
+
+std::vector<std::unique_ptr<JobApplication>> PostgresJobApplicationRepository::findJobApplications(
+        const JobApplicationQuery& query) {
+    if (!initializeReadDatabase()) {
+        return std::vector<std::unique_ptr<JobApplication>>();
+    }
+
+    std::vector<std::string> params;
+    std::string sql = query.toSql(params);
+    return loadJobApplications(readDb->executeParameterizedQuery(sql, params));
+}
+
+JobApplicationPage PostgresJobApplicationRepository::getJobApplicationsPage(size_t pageSize, const std::string& cursor) {
+    return queryPage("", {}, pageSize, cursor);
+}
+
+JobApplicationPage PostgresJobApplicationRepository::getJobApplicationsByCompanyPage(const std::string& company,
+                                                                                     size_t pageSize,
+                                                                                     const std::string& cursor) {
+    return queryPage("LOWER(company) LIKE LOWER($1)", {"%" + company + "%"}, pageSize, cursor);
+}
+
+JobApplicationPage PostgresJobApplicationRepository::getJobApplicationsByStatusPage(ApplicationStatus status,
+                                                                                    size_t pageSize,
+                                                                                    const std::string& cursor) {
+    return queryPage("status = $1", {std::to_string(static_cast<int>(status))}, pageSize, cursor);
+}
+
+JobApplicationPage PostgresJobApplicationRepository::getJobApplicationsByDateRangePage(const std::string& startDate,
+                                                                                       const std::string& endDate,
+                                                                                       size_t pageSize,
+                                                                                       const std::string& cursor) {
+    return queryPage("date_applied BETWEEN $1 AND $2", {startDate, endDate}, pageSize, cursor);
+}
+
+JobApplicationPage PostgresJobApplicationRepository::queryPage(const std::string& filter, std::vector<std::string> params,
+                                                               size_t pageSize, const std::string& cursor) {
+    JobApplicationPage page;
+    if (pageSize == 0 || !initializeReadDatabase()) {
+        return page;
+    }
+
+    std::vector<std::string> conditions;
+    if (!filter.empty()) {
+        conditions.push_back(filter);
+    }
+    if (!cursor.empty()) {
+        std::string dateApplied, id;
+        if (!parseCursor(cursor, dateApplied, id) ||
+            id.find_first_not_of("0123456789") != std::string::npos) {
+            return page;
+        }
+        // A row comparison, so the (date_applied, id) index seeks straight
+        // to the cursor instead of skipping over earlier pages.
+        params.push_back(dateApplied);
+        params.push_back(id);
+        conditions.push_back("(date_applied, id) < ($" + std::to_string(params.size() - 1) +
+                             "::date, $" + std::to_string(params.size()) + "::integer)");
+    }
+
+    std::string query = "SELECT * FROM job_applications";
+    for (size_t i = 0; i < conditions.size(); i++) {
+        query += (i == 0 ? " WHERE " : " AND ") + conditions[i];
+    }
+    // One row past the page tells us whether another page follows.
+    params.push_back(std::to_string(pageSize + 1));
+    query += " ORDER BY date_applied DESC, id DESC LIMIT $" + std::to_string(params.size());
+
+    DatabaseResult rows(readDb->executeParameterizedQuery(query, params));
+    if (!rows.isValid()) {
+        return page;
+    }
+
+    page.applications = loadJobApplications(rows);
+    if (page.applications.size() > pageSize) {
+        page.applications.resize(pageSize);
+        // The cursor comes from decoded values: with binary results the raw
+        // bytes of a date or integer are not text.
+        rows.reset();
+        for (size_t i = 0; i < pageSize; i++) {
+            rows.next();
+        }
+        page.nextCursor = rows.getString("date_applied") + "|" + rows.getString("id");
+    }
+    return page;
+}
+
+bool PostgresJobApplicationRepository::updateJobApplication(const JobApplication& application) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    // An unchanged row is not rewritten, so it leaves no dead tuple or
+    // index entries behind. The existence check rides in the same flight.
+    using Mapper = RowMapper<JobApplication>;
+    static const std::string query =
+        "UPDATE job_applications SET " + Mapper::assignmentList(columnBindings(), COLUMN_UPDATE, 2) +
+        ", updated_at = CURRENT_TIMESTAMP WHERE application_id = $1 AND (" +
+        Mapper::columnList(columnBindings(), COLUMN_UPDATE) + ") IS DISTINCT FROM (" +
+        Mapper::placeholderList(columnBindings(), COLUMN_UPDATE, 2) + ")";
+
+    std::vector<std::string> params = {application.getApplicationId()};
+    Mapper::appendParams(columnBindings(), COLUMN_UPDATE, application, params);
+
+    DatabaseConnection::Batch batch(*db);
+    batch.add(query, params);
+    size_t exists = batch.add("SELECT 1 FROM job_applications WHERE application_id = $1", {application.getApplicationId()});
+    queueDateSync(batch, application);
+
+    bool success = batch.execute();
+    DatabaseResult found(batch.takeResult(exists));
+    if (found.isValid() && found.getRowCount() == 0) {
+        std::cerr << "Job application with ID " << application.getApplicationId() << " does not exist" << std::endl;
+        return false;
+    }
+    return success;
+}
+
+bool PostgresJobApplicationRepository::upsertJobApplication(const JobApplication& application) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    using Mapper = RowMapper<JobApplication>;
+    static const std::string query = [] {
+        std::string assignments;
+        std::string current;
+        std::string excluded;
+        for (const auto& binding : columnBindings()) {
+            if (binding.usage & COLUMN_UPDATE) {
+                std::string separator = current.empty() ? "" : ", ";
+                assignments += std::string(binding.column) + " = EXCLUDED." + binding.column + ", ";
+                current += separator + "job_applications." + binding.column;
+                excluded += separator + "EXCLUDED." + binding.column;
+            }
+        }
+        return "INSERT INTO job_applications (" + Mapper::columnList(columnBindings(), COLUMN_INSERT) +
+               ") VALUES (" + Mapper::placeholderList(columnBindings(), COLUMN_INSERT) +
+               ") ON CONFLICT (application_id) DO UPDATE SET " + assignments +
+               "updated_at = CURRENT_TIMESTAMP WHERE (" + current + ") IS DISTINCT FROM (" + excluded + ")";
+    }();
+
+    std::vector<std::string> params;
+    Mapper::appendParams(columnBindings(), COLUMN_INSERT, application, params);
+
+    DatabaseConnection::Batch batch(*db);
+    batch.add(query, params);
+    queueDateSync(batch, application);
+    return batch.execute();
+}
+
+// Brings both child tables in line with the application's date sets:
+// only dates that were removed are deleted and only new ones inserted, so
+// an unchanged list costs two no-op statements instead of a full rewrite.
+void PostgresJobApplicationRepository::queueDateSync(DatabaseConnection::Batch& batch, const JobApplication& application) {
+    static const char* const tables[][2] = {
+        {"interview_dates", "interview_date"},
+        {"followup_dates", "followup_date"}
+    };
+    static const std::vector<std::string> statements = [] {
+        std::vector<std::string> sql;
+        for (const auto& table : tables) {
+            std::string name = table[0];
+            std::string column = table[1];
+            sql.push_back("DELETE FROM " + name + " WHERE application_id = $1 AND " + column +
+                          " <> ALL($2::date[])");
+            sql.push_back("INSERT INTO " + name + " (application_id, " + column + ") "
+                          "SELECT DISTINCT $1::text, d FROM unnest($2::date[]) AS d "
+                          "WHERE NOT EXISTS (SELECT 1 FROM " + name + " c WHERE c.application_id = $1 AND c." +
+                          column + " = d)");
+        }
+        return sql;
+    }();
+
+    std::vector<std::string> interviewParams = {application.getApplicationId(),
+                                                toArrayLiteral(application.getInterviewDates())};
+    std::vector<std::string> followUpParams = {application.getApplicationId(),
+                                               toArrayLiteral(application.getFollowUpDates())};
+    batch.add(statements[0], interviewParams);
+    batch.add(statements[1], interviewParams);
+    batch.add(statements[2], followUpParams);
+    batch.add(statements[3], followUpParams);
+}
+
+bool PostgresJobApplicationRepository::updateJobApplicationStatus(const std::string& applicationId, ApplicationStatus status) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    std::string query = "UPDATE job_applications SET status = $2, updated_at = CURRENT_TIMESTAMP WHERE application_id = $1";
+    return db->executeNonQuery(query, applicationId, status);
+}
+
+bool PostgresJobApplicationRepository::addInterviewDate(const std::string& applicationId, const std::string& interviewDate) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    std::string query = "INSERT INTO interview_dates (application_id, interview_date) VALUES ($1, $2)";
+    std::vector<std::string> params = {applicationId, interviewDate};
+
+    return db->executeParameterizedNonQuery(query, params);
+}
+
+bool PostgresJobApplicationRepository::addFollowUpDate(const std::string& applicationId, const std::string& followUpDate) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    std::string query = "INSERT INTO followup_dates (application_id, followup_date) VALUES ($1, $2)";
+    std::vector<std::string> params = {applicationId, followUpDate};
+
+    return db->executeParameterizedNonQuery(query, params);
+}
+
+bool PostgresJobApplicationRepository::deleteJobApplication(const std::string& applicationId) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    if (!db->beginTransaction()) {
+        return false;
+    }
+
+    bool success = deleteInterviewDates(applicationId) &&
+                  deleteFollowUpDates(applicationId);
+
+    if (success) {
+        std::string query = "DELETE FROM job_applications WHERE application_id = $1";
+        std::vector<std::string> params = {applicationId};
+        success = db->executeParameterizedNonQuery(query, params);
+    }
+
+    if (success) {
+        db->commitTransaction();
+    } else {
+        db->rollbackTransaction();
+    }
+
+    return success;
+}
+
+bool PostgresJobApplicationRepository::deleteJobApplicationsByCompany(const std::string& company) {
+    if (!initializeDatabase()) {
+        return false;
+    }
+
+    std::string query = "DELETE FROM job_applications WHERE LOWER(company) = LOWER($1)";
+    std::vector<std::string> params = {company};
+
+    return db->executeParameterizedNonQuery(query, params);
+}
+
+int PostgresJobApplicationRepository::getJobApplicationCount() const {
+    if (!const_cast<PostgresJobApplicationRepository*>(this)->initializeReadDatabase()) {
+        return 0;
+    }
+
+    std::string query = "SELECT COUNT(*) FROM job_applications";
+    PGresult* result = readDb->executeQuery(query);
+
+    if (!result) {
+        return 0;
+    }
+
+    DatabaseResult dbResult(result);
+    if (dbResult.next()) {
+        return dbResult.getInt(0);
+    }
+
+    return 0;
+}
+
+int PostgresJobApplicationRepository::getJobApplicationCountByStatus(ApplicationStatus status) const {
+    if (!const_cast<PostgresJobApplicationRepository*>(this)->initializeReadDatabase()) {
+        return 0;
+    }
+
+    std::string query = "SELECT COUNT(*) FROM job_applications WHERE status = $1";
+    PGresult* result = readDb->execute(query, status);
+    if (!result) {
+        return 0;
+    }
+
+    DatabaseResult dbResult(result);
+    if (dbResult.next()) {
+        return dbResult.getInt(0);
+    }
+
+    return 0;
+}
+
+std::map<ApplicationStatus, int> PostgresJobApplicationRepository::getJobApplicationCountsByStatus(
+        const std::vector<ApplicationStatus>& statuses) const {
+    std::map<ApplicationStatus, int> counts;
+
+    if (!const_cast<PostgresJobApplicationRepository*>(this)->initializeReadDatabase()) {
+        return counts;
+    }
+
+    std::string query = "SELECT COUNT(*) FROM job_applications WHERE status = $1";
+
+    for (ApplicationStatus status : statuses) {
+        counts[status] = 0;
+        std::vector<std::string> params = {std::to_string(static_cast<int>(status))};
+        readDb->executeAsync(query, params, [&counts, status](PGresult* result) {
+            DatabaseResult dbResult(result);
+            if (dbResult.next()) {
+                counts[status] = dbResult.getInt(0);
+            }
+        });
+    }
+
+    readDb->waitForAsync();
+    return counts;
+}
+
+bool PostgresJobApplicationRepository::exportToCsv(std::ostream& out) {
+    if (!initializeReadDatabase()) {
+        return false;
+    }
+
+    // Postgres formats and quotes the CSV itself; status names come from
+    // JobApplication so the server-side mapping cannot drift from the enum.
+    std::ostringstream statusName;
+    statusName << "CASE ja.status";
+    for (int status = static_cast<int>(ApplicationStatus::APPLIED);
+         status <= static_cast<int>(ApplicationStatus::ACCEPTED); status++) {
+        statusName << " WHEN " << status << " THEN '"
+                   << JobApplication::statusToString(static_cast<ApplicationStatus>(status)) << "'";
+    }
+    statusName << " ELSE 'UNKNOWN' END";
+
+    std::string query = R"(
+        COPY (
+            SELECT ja.application_id AS "Application ID", ja.job_id AS "Job ID",
+                   ja.job_title AS "Job Title", ja.company AS "Company",
+                   ja.date_applied AS "Date Applied", )" + statusName.str() + R"( AS "Status",
+                   ja.contact_name AS "Contact Name", ja.contact_email AS "Contact Email",
+                   ja.contact_phone AS "Contact Phone", ja.comments AS "Comments",
+                   ja.application_url AS "Application URL", ja.salary_offered AS "Salary Offered",
+                   ja.expected_salary AS "Expected Salary", ja.response_deadline AS "Response Deadline",
+                   ja.referral_source AS "Referral Source", ja.application_method AS "Application Method",
+                   ja.notes AS "Notes",
+                   (SELECT string_agg(i.interview_date::text, ';' ORDER BY i.interview_date)
+                      FROM interview_dates i WHERE i.application_id = ja.application_id) AS "Interview Dates",
+                   (SELECT string_agg(f.followup_date::text, ';' ORDER BY f.followup_date)
+                      FROM followup_dates f WHERE f.application_id = ja.application_id) AS "Follow Up Dates"
+            FROM job_applications ja
+            ORDER BY ja.date_applied DESC, ja.id DESC
+        ) TO STDOUT WITH (FORMAT csv, HEADER)
+    )";
+
+    return readDb->copyOut(query, out);
+}
+
+bool PostgresJobApplicationRepository::jobApplicationExists(const std::string& applicationId) const {
+    if (!const_cast<PostgresJobApplicationRepository*>(this)->initializeDatabase()) {
+        return false;
+    }
+
+    std::string query = "SELECT COUNT(*) FROM job_applications WHERE application_id = $1";
+    std::vector<std::string> params = {applicationId};
+
+    PGresult* result = db->executeParameterizedQuery(query, params);
+    if (!result) {
+        return false;
+    }
+
+    DatabaseResult dbResult(result);
+    if (dbResult.next()) {
+        return dbResult.getInt(0) > 0;
+    }
+
+    return false;
+}
+
+JobApplication* PostgresJobApplicationRepository::mapResultToJobApplication(DatabaseResult& result) {
+    JobApplication* app = new JobApplication();
+    rowMapper.map(result, *app);
+    return app;
+}
+
+std::vector<std::unique_ptr<JobApplication>> PostgresJobApplicationRepository::loadJobApplications(PGresult* result) {
+    if (!result) {
+        return std::vector<std::unique_ptr<JobApplication>>();
+    }
+
+    DatabaseResult dbResult(result);
+    return loadJobApplications(dbResult);
+}
+
+std::vector<std::unique_ptr<JobApplication>> PostgresJobApplicationRepository::loadJobApplications(
+        DatabaseResult& dbResult) {
+    std::vector<std::unique_ptr<JobApplication>> applications;
+    std::vector<std::string> applicationIds;
+    std::unordered_map<std::string, JobApplication*> byId;
+    applications.reserve(dbResult.getRowCount());
+    applicationIds.reserve(dbResult.getRowCount());
+
+    while (dbResult.next()) {
+        std::unique_ptr<JobApplication> app(mapResultToJobApplication(dbResult));
+        applicationIds.push_back(app->getApplicationId());
+        byId.emplace(app->getApplicationId(), app.get());
+        applications.push_back(std::move(app));
+    }
+
+    if (applications.empty()) {
+        return applications;
+    }
+
+    // Child dates for the whole list in one flight of two queries, however
+    // many parents there are, then stitched on by application_id.
+    std::vector<std::string> params = {toArrayLiteral(applicationIds)};
+    std::future<DatabaseResult> interviewResult = readDb->executeAsync(
+        "SELECT application_id, interview_date FROM interview_dates "
+        "WHERE application_id = ANY($1::text[]) ORDER BY interview_date", params);
+    std::future<DatabaseResult> followUpResult = readDb->executeAsync(
+        "SELECT application_id, followup_date FROM followup_dates "
+        "WHERE application_id = ANY($1::text[]) ORDER BY followup_date", params);
+    readDb->waitForAsync();
+
+    DatabaseResult interviewDates = interviewResult.get();
+    while (interviewDates.next()) {
+        auto app = byId.find(interviewDates.getString(0));
+        if (app != byId.end()) {
+            app->second->addInterviewDate(interviewDates.getString(1));
+        }
+    }
+
+    DatabaseResult followUpDates = followUpResult.get();
+    while (followUpDates.next()) {
+        auto app = byId.find(followUpDates.getString(0));
+        if (app != byId.end()) {
+            app->second->addFollowUpDate(followUpDates.getString(1));
+        }
+    }
+
+    return applications;
+}
+
+bool PostgresJobApplicationRepository::deleteInterviewDates(const std::string& applicationId) {
+    std::string query = "DELETE FROM interview_dates WHERE application_id = $1";
+    std::vector<std::string> params = {applicationId};
+    return db->executeParameterizedNonQuery(query, params);
+}
+
+bool PostgresJobApplicationRepository::deleteFollowUpDates(const std::string& applicationId) {
+    std::string query = "DELETE FROM followup_dates WHERE application_id = $1";
+    std::vector<std::string> params = {applicationId};
+    return db->executeParameterizedNonQuery(query, params);
+}
+
+void PostgresJobApplicationRepository::queueInterviewDateInserts(DatabaseConnection::Batch& batch, const std::string& applicationId,
+                                                                 const std::vector<std::string>& dates) {
+    for (const auto& date : dates) {
+        batch.add("INSERT INTO interview_dates (application_id, interview_date) VALUES ($1, $2)", {applicationId, date});
+    }
+}
+
+void PostgresJobApplicationRepository::queueFollowUpDateInserts(DatabaseConnection::Batch& batch, const std::string& applicationId,
+                                                                const std::vector<std::string>& dates) {
+    for (const auto& date : dates) {
+        batch.add("INSERT INTO followup_dates (application_id, followup_date) VALUES ($1, $2)", {applicationId, date});
+    }
+}
+
+std::vector<std::string> PostgresJobApplicationRepository::splitDateList(const std::string& dates) const {
+    std::vector<std::string> result;
+    std::istringstream stream(dates);
+    std::string date;
+    while (std::getline(stream, date, ',')) {
+        if (!date.empty()) {
+            result.push_back(date);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,92 @@
+#ifndef POSTGRESJOBAPPLICATIONREPOSITORY_H
+#define POSTGRESJOBAPPLICATIONREPOSITORY_H
+
+#include "baseController.h"
+#include "jobApplicationRepository.h"
+#include "rowMapper.h"
+
+// Job applications in PostgreSQL, the tables in schema.sql. Writes go to
+// the router's primary and reads to a replica when it has one. Overrides
+// every generic repository method with SQL: filters, pages and counts run
+// server-side, bulk creates use COPY and CSV export is a server-side COPY.
+class PostgresJobApplicationRepository : public JobApplicationRepository, private DatabaseClient {
+private:
+    RowMapper<JobApplication> rowMapper;
+
+public:
+    explicit PostgresJobApplicationRepository(std::shared_ptr<ConnectionRouter> router);
+
+    // Column <-> member bindings for job_applications.
+    static const RowMapper<JobApplication>::Bindings& columnBindings();
+
+    bool createJobApplication(const JobApplication& application) override;
+    std::unique_ptr<JobApplication> getJobApplicationById(const std::string& applicationId) override;
+    std::vector<std::unique_ptr<JobApplication>> getAllJobApplications() override;
+    bool forEachJobApplication(const std::function<bool(const JobApplication&)>& callback) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByCompany(const std::string& company) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByStatus(ApplicationStatus status) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByDateRange(const std::string& startDate,
+                                                                              const std::string& endDate) override;
+
+    bool updateJobApplication(const JobApplication& application) override;
+    bool updateJobApplicationStatus(const std::string& applicationId, ApplicationStatus status) override;
+    bool addInterviewDate(const std::string& applicationId, const std::string& interviewDate) override;
+    bool addFollowUpDate(const std::string& applicationId, const std::string& followUpDate) override;
+
+    bool deleteJobApplication(const std::string& applicationId) override;
+    bool deleteJobApplicationsByCompany(const std::string& company) override;
+
+    int getJobApplicationCount() const override;
+    int getJobApplicationCountByStatus(ApplicationStatus status) const override;
+    bool jobApplicationExists(const std::string& applicationId) const override;
+
+    // Each batch costs one existence query and three COPYs in one
+    // transaction. A rejected row does not fail its batch: that batch is
+    // retried row by row and only the bad rows are reported.
+    BulkCreateResult createJobApplications(const std::vector<JobApplication>& applications,
+                                           size_t batchSize) override;
+    bool upsertJobApplication(const JobApplication& application) override;
+    std::vector<std::unique_ptr<JobApplication>> findJobApplications(const JobApplicationQuery& query) override;
+
+    // Each page seeks straight to its cursor, so deep pages cost the same
+    // as the first. The cursor key is the serial id.
+    JobApplicationPage getJobApplicationsPage(size_t pageSize, const std::string& cursor) override;
+    JobApplicationPage getJobApplicationsByCompanyPage(const std::string& company, size_t pageSize,
+                                                       const std::string& cursor) override;
+    JobApplicationPage getJobApplicationsByStatusPage(ApplicationStatus status, size_t pageSize,
+                                                      const std::string& cursor) override;
+    JobApplicationPage getJobApplicationsByDateRangePage(const std::string& startDate, const std::string& endDate,
+                                                         size_t pageSize, const std::string& cursor) override;
+
+    // All counts go out in one flight.
+    std::map<ApplicationStatus, int> getJobApplicationCountsByStatus(
+        const std::vector<ApplicationStatus>& statuses) const override;
+
+    bool exportToCsv(std::ostream& out) override;
+
+private:
+    JobApplication* mapResultToJobApplication(DatabaseResult& result);
+    // Takes ownership of `result`; fills in child dates with two queries in total.
+    std::vector<std::unique_ptr<JobApplication>> loadJobApplications(PGresult* result);
+    // Reads `dbResult` from the start and leaves it past the last row.
+    std::vector<std::unique_ptr<JobApplication>> loadJobApplications(DatabaseResult& dbResult);
+    JobApplicationPage queryPage(const std::string& filter, std::vector<std::string> params, size_t pageSize,
+                                 const std::string& cursor);
+    void createJobApplicationBatch(const std::vector<JobApplication>& applications, const std::vector<size_t>& indexes,
+                                   BulkCreateResult& outcome);
+    bool copyJobApplications(const std::vector<JobApplication>& applications, const std::vector<size_t>& indexes,
+                             std::string& error);
+    bool copyDates(const char* table, const char* column, std::vector<std::string> (JobApplication::*dates)() const,
+                   const std::vector<JobApplication>& applications, const std::vector<size_t>& indexes,
+                   std::string& error);
+    void queueDateSync(DatabaseConnection::Batch& batch, const JobApplication& application);
+    bool deleteInterviewDates(const std::string& applicationId);
+    bool deleteFollowUpDates(const std::string& applicationId);
+    void queueInterviewDateInserts(DatabaseConnection::Batch& batch, const std::string& applicationId,
+                                   const std::vector<std::string>& dates);
+    void queueFollowUpDateInserts(DatabaseConnection::Batch& batch, const std::string& applicationId,
+                                  const std::vector<std::string>& dates);
+    std::vector<std::string> splitDateList(const std::string& dates) const;
+};
+
+#endif // POSTGRESJOBAPPLICATIONREPOSITORY_H
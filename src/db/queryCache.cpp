@@ -0,0 +1,400 @@
+#include "queryCache.h"
+#include <cctype>
+
+std::shared_ptr<QueryCache> QueryCache::instance = nullptr;
+std::mutex QueryCache::instanceMutex;
+
+QueryCacheConfig::QueryCacheConfig() : ttl(30000), maxBytes(16 * 1024 * 1024) {}
+
+namespace {
+
+// Identifiers (lowercased unless quoted, schema prefix dropped) and the
+// punctuation that matters for finding table names. Literals and comments
+// are skipped.
+std::vector<std::string> tokenize(const std::string& query) {
+    std::vector<std::string> tokens;
+    size_t i = 0;
+    while (i < query.size()) {
+        char c = query[i];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            i++;
+        } else if (c == '-' && i + 1 < query.size() && query[i + 1] == '-') {
+            i = query.find('\n', i);
+            if (i == std::string::npos) {
+                break;
+            }
+        } else if (c == '/' && i + 1 < query.size() && query[i + 1] == '*') {
+            i = query.find("*/", i + 2);
+            if (i == std::string::npos) {
+                break;
+            }
+            i += 2;
+        } else if (c == '\'') {
+            for (i++; i < query.size(); i++) {
+                if (query[i] == '\'') {
+                    if (i + 1 < query.size() && query[i + 1] == '\'') {
+                        i++;
+                    } else {
+                        break;
+                    }
+                }
+            }
+            i++;
+        } else if (c == '"' || c == '_' || std::isalpha(static_cast<unsigned char>(c))) {
+            // A possibly qualified name: schema.table, "Quoted".name, ...
+            std::string name;
+            while (i < query.size()) {
+                name.clear();
+                if (query[i] == '"') {
+                    size_t end = query.find('"', i + 1);
+                    if (end == std::string::npos) {
+                        end = query.size();
+                    }
+                    name = query.substr(i + 1, end - i - 1);
+                    i = end + 1;
+                } else {
+                    while (i < query.size() && (std::isalnum(static_cast<unsigned char>(query[i])) ||
+                                                query[i] == '_' || query[i] == '$')) {
+                        name += static_cast<char>(std::tolower(static_cast<unsigned char>(query[i])));
+                        i++;
+                    }
+                }
+                if (i < query.size() && query[i] == '.') {
+                    i++;
+                } else {
+                    break;
+                }
+            }
+            tokens.push_back(name);
+        } else if (c == '(' || c == ')' || c == ',' || c == ';') {
+            tokens.push_back(std::string(1, c));
+            i++;
+        } else {
+            i++;
+        }
+    }
+    return tokens;
+}
+
+bool isName(const std::string& token) {
+    return !token.empty() && token != "(" && token != ")" && token != "," && token != ";";
+}
+
+bool isClauseKeyword(const std::string& token) {
+    static const std::unordered_set<std::string> keywords = {
+        "where", "join", "inner", "left", "right", "full", "cross", "natural", "on", "using",
+        "order", "group", "having", "limit", "offset", "union", "intersect", "except", "window",
+        "for", "fetch", "returning", "lateral", "set", "values", "select", "tablesample"
+    };
+    return keywords.count(token) > 0;
+}
+
+// Reads "[ONLY] name [[AS] alias] [, ...]" starting at `i`.
+void readTableList(const std::vector<std::string>& tokens, size_t i, bool list,
+                   std::vector<std::string>& tables) {
+    while (i < tokens.size()) {
+        if (tokens[i] == "only" || tokens[i] == "lateral") {
+            i++;
+        }
+        if (i >= tokens.size() || !isName(tokens[i]) || isClauseKeyword(tokens[i])) {
+            return;
+        }
+        tables.push_back(tokens[i++]);
+
+        if (i < tokens.size() && tokens[i] == "as") {
+            i += 2;
+        } else if (i < tokens.size() && isName(tokens[i]) && !isClauseKeyword(tokens[i])) {
+            i++;
+        }
+        if (!list || i >= tokens.size() || tokens[i] != ",") {
+            return;
+        }
+        i++;
+    }
+}
+
+}
+
+QueryCache::QueryCache(const QueryCacheConfig& config)
+    : totalBytes(0), generation(0), clearedGeneration(0), ttl(config.ttl), maxBytes(config.maxBytes),
+      hits(0), misses(0), evictions(0), invalidations(0) {}
+
+QueryCache::~QueryCache() {}
+
+PGresult* QueryCache::lookup(const std::string& key) {
+    std::shared_ptr<const PGresult> result;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            misses++;
+            return nullptr;
+        }
+        if (std::chrono::steady_clock::now() >= it->second.expires) {
+            erase(it);
+            misses++;
+            return nullptr;
+        }
+
+        lru.splice(lru.begin(), lru, it->second.lruPosition);
+        result = it->second.result;
+        hits++;
+    }
+
+    // Copy outside the lock; the shared_ptr keeps the entry's result alive
+    // even if it is evicted meanwhile.
+    return PQcopyResult(result.get(), PG_COPYRES_ATTRS | PG_COPYRES_TUPLES | PG_COPYRES_NOTICEHOOKS);
+}
+
+unsigned long long QueryCache::getGeneration() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return generation;
+}
+
+void QueryCache::store(const std::string& key, const std::string& query, const PGresult* result,
+                       unsigned long long fetchedAt) {
+    if (!result || PQresultStatus(result) != PGRES_TUPLES_OK) {
+        return;
+    }
+
+    size_t bytes = estimateBytes(key, result);
+    std::vector<std::string> tables = readTables(query);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (ttl.count() <= 0 || bytes > maxBytes / 4 || clearedGeneration > fetchedAt) {
+        return;
+    }
+    for (const auto& table : tables) {
+        auto invalidated = tableGenerations.find(table);
+        if (invalidated != tableGenerations.end() && invalidated->second > fetchedAt) {
+            return;
+        }
+    }
+
+    PGresult* copy = PQcopyResult(result, PG_COPYRES_ATTRS | PG_COPYRES_TUPLES | PG_COPYRES_NOTICEHOOKS);
+    if (!copy) {
+        return;
+    }
+
+    auto existing = entries.find(key);
+    if (existing != entries.end()) {
+        erase(existing);
+    }
+
+    lru.push_front(key);
+    Entry& entry = entries[key];
+    entry.result = std::shared_ptr<const PGresult>(copy, [](const PGresult* r) { PQclear(const_cast<PGresult*>(r)); });
+    entry.bytes = bytes;
+    entry.expires = std::chrono::steady_clock::now() + ttl;
+    entry.tables = tables;
+    entry.lruPosition = lru.begin();
+    totalBytes += bytes;
+    for (const auto& table : tables) {
+        keysByTable[table].insert(key);
+    }
+
+    while (totalBytes > maxBytes && !lru.empty()) {
+        erase(entries.find(lru.back()));
+        evictions++;
+    }
+}
+
+void QueryCache::invalidateFor(const std::string& query) {
+    std::vector<std::string> tables;
+    bool known = writtenTables(query, tables);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!known) {
+        clearLocked();
+        return;
+    }
+    for (const auto& table : tables) {
+        invalidateTableLocked(table);
+    }
+}
+
+void QueryCache::invalidateTable(const std::string& table) {
+    std::lock_guard<std::mutex> lock(mutex);
+    invalidateTableLocked(table);
+}
+
+void QueryCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    clearLocked();
+}
+
+void QueryCache::invalidateTableLocked(const std::string& table) {
+    tableGenerations[table] = ++generation;
+
+    auto keys = keysByTable.find(table);
+    if (keys == keysByTable.end()) {
+        return;
+    }
+
+    std::vector<std::string> stale(keys->second.begin(), keys->second.end());
+    for (const auto& key : stale) {
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            erase(it);
+            invalidations++;
+        }
+    }
+}
+
+void QueryCache::clearLocked() {
+    clearedGeneration = ++generation;
+    invalidations += entries.size();
+    entries.clear();
+    lru.clear();
+    keysByTable.clear();
+    totalBytes = 0;
+}
+
+void QueryCache::erase(std::unordered_map<std::string, Entry>::iterator it) {
+    for (const auto& table : it->second.tables) {
+        auto keys = keysByTable.find(table);
+        if (keys != keysByTable.end()) {
+            keys->second.erase(it->first);
+            if (keys->second.empty()) {
+                keysByTable.erase(keys);
+            }
+        }
+    }
+    totalBytes -= it->second.bytes;
+    lru.erase(it->second.lruPosition);
+    entries.erase(it);
+}
+
+size_t QueryCache::estimateBytes(const std::string& key, const PGresult* result) {
+    // Values plus libpq's per-value and per-column bookkeeping, roughly.
+    int numRows = PQntuples(result);
+    int numFields = PQnfields(result);
+    size_t bytes = 2 * key.size() + 256 + static_cast<size_t>(numFields) * 64;
+    for (int row = 0; row < numRows; row++) {
+        for (int field = 0; field < numFields; field++) {
+            bytes += PQgetlength(result, row, field) + 1 + 16;
+        }
+    }
+    return bytes;
+}
+
+void QueryCache::setTtl(std::chrono::milliseconds ttl) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->ttl = ttl;
+}
+
+std::chrono::milliseconds QueryCache::getTtl() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ttl;
+}
+
+void QueryCache::setMaxBytes(size_t maxBytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->maxBytes = maxBytes;
+    while (totalBytes > maxBytes && !lru.empty()) {
+        erase(entries.find(lru.back()));
+        evictions++;
+    }
+}
+
+size_t QueryCache::getMaxBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return maxBytes;
+}
+
+QueryCacheStats QueryCache::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    QueryCacheStats stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.evictions = evictions;
+    stats.invalidations = invalidations;
+    stats.entries = entries.size();
+    stats.bytes = totalBytes;
+    return stats;
+}
+
+std::vector<std::string> QueryCache::readTables(const std::string& query) {
+    std::vector<std::string> tokens = tokenize(query);
+    std::vector<std::string> tables;
+    for (size_t i = 0; i < tokens.size(); i++) {
+        if (tokens[i] == "from" || tokens[i] == "join") {
+            readTableList(tokens, i + 1, tokens[i] == "from", tables);
+        }
+    }
+    return tables;
+}
+
+bool QueryCache::writtenTables(const std::string& query, std::vector<std::string>& tables) {
+    std::vector<std::string> tokens = tokenize(query);
+    if (tokens.empty()) {
+        return true;
+    }
+
+    // Transaction control and session commands leave table contents alone.
+    static const std::unordered_set<std::string> noWrites = {
+        "begin", "start", "commit", "end", "rollback", "abort", "savepoint", "release",
+        "listen", "unlisten", "notify", "deallocate", "prepare", "analyze", "vacuum", "show",
+        "set", "reset", "discard"
+    };
+    const std::string& verb = tokens[0];
+    auto at = [&tokens](size_t i) -> const std::string& {
+        static const std::string none;
+        return i < tokens.size() ? tokens[i] : none;
+    };
+
+    if (noWrites.count(verb)) {
+        return true;
+    }
+    if (verb == "select") {
+        // A locking read (FOR UPDATE / FOR SHARE ...) changes no rows.
+        for (size_t i = 1; i < tokens.size(); i++) {
+            if (tokens[i] == "for" && (at(i + 1) == "update" || at(i + 1) == "share" ||
+                                       at(i + 1) == "no" || at(i + 1) == "key")) {
+                return true;
+            }
+        }
+        return false;
+    }
+    if ((verb == "insert" || verb == "merge") && at(1) == "into") {
+        readTableList(tokens, 2, false, tables);
+    } else if (verb == "update") {
+        readTableList(tokens, 1, false, tables);
+    } else if (verb == "delete" && at(1) == "from") {
+        readTableList(tokens, 2, false, tables);
+    } else if (verb == "truncate") {
+        readTableList(tokens, at(1) == "table" ? 2 : 1, true, tables);
+    } else if (verb == "copy") {
+        // COPY table FROM invalidates; COPY ... TO only reads.
+        if (at(1) == "(") {
+            return true;
+        }
+        for (size_t i = 2; i < tokens.size(); i++) {
+            if (tokens[i] == "from") {
+                tables.push_back(tokens[1]);
+                break;
+            }
+            if (tokens[i] == "to") {
+                break;
+            }
+        }
+        return true;
+    } else if ((verb == "alter" || verb == "drop") && at(1) == "table") {
+        size_t i = 2;
+        if (at(i) == "if") {
+            i += 2;  // IF EXISTS
+        }
+        readTableList(tokens, i, verb == "drop", tables);
+    }
+    return !tables.empty();
+}
+
+std::shared_ptr<QueryCache> QueryCache::getInstance() {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    return instance;
+}
+
+void QueryCache::setInstance(std::shared_ptr<QueryCache> instance) {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    QueryCache::instance = instance;
+}
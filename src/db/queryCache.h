@@ -0,0 +1,121 @@
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <libpq-fe.h>
+
+struct QueryCacheConfig {
+    // How long a cached result may be served after it was fetched.
+    std::chrono::milliseconds ttl;
+
+    // Approximate memory budget for cached results; least recently used
+    // entries are evicted beyond it. A single result larger than a quarter
+    // of the budget is never cached.
+    size_t maxBytes;
+
+    QueryCacheConfig();
+};
+
+struct QueryCacheStats {
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+    unsigned long long invalidations;
+    size_t entries;
+    size_t bytes;
+};
+
+// Read-result cache keyed by query text plus bound parameters. Each entry
+// remembers the tables its query reads; a write to one of those tables
+// through any connection that shares the cache drops it. Shared by every
+// connection in the process and safe to use from multiple threads.
+//
+// On its own, invalidation only sees writes made through this process.
+// Rows changed by other clients are picked up when the entry's TTL runs
+// out, or sooner by table through a CacheInvalidationListener.
+class QueryCache {
+private:
+    struct Entry {
+        std::shared_ptr<const PGresult> result;
+        size_t bytes;
+        std::chrono::steady_clock::time_point expires;
+        std::vector<std::string> tables;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    std::unordered_map<std::string, Entry> entries;
+    std::list<std::string> lru;
+    std::unordered_map<std::string, std::unordered_set<std::string>> keysByTable;
+    size_t totalBytes;
+
+    // Every invalidation bumps the generation. A result fetched before an
+    // invalidation of one of its tables finished is not stored.
+    unsigned long long generation;
+    unsigned long long clearedGeneration;
+    std::unordered_map<std::string, unsigned long long> tableGenerations;
+
+    std::chrono::milliseconds ttl;
+    size_t maxBytes;
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+    unsigned long long invalidations;
+    mutable std::mutex mutex;
+
+    static std::shared_ptr<QueryCache> instance;
+    static std::mutex instanceMutex;
+
+    void erase(std::unordered_map<std::string, Entry>::iterator it);
+    void invalidateTableLocked(const std::string& table);
+    void clearLocked();
+    static size_t estimateBytes(const std::string& key, const PGresult* result);
+
+public:
+    explicit QueryCache(const QueryCacheConfig& config = QueryCacheConfig());
+    ~QueryCache();
+
+    QueryCache(const QueryCache&) = delete;
+    QueryCache& operator=(const QueryCache&) = delete;
+
+    // Returns a copy of the cached result, owned by the caller like any
+    // other PGresult, or nullptr on a miss.
+    PGresult* lookup(const std::string& key);
+
+    // Take the generation before running a query and pass it to store().
+    unsigned long long getGeneration() const;
+    void store(const std::string& key, const std::string& query, const PGresult* result,
+               unsigned long long fetchedAt);
+
+    // Drops cached results that read the tables `query` writes. Statements
+    // the cache cannot attribute to tables clear it entirely.
+    void invalidateFor(const std::string& query);
+    void invalidateTable(const std::string& table);
+    void clear();
+
+    void setTtl(std::chrono::milliseconds ttl);
+    std::chrono::milliseconds getTtl() const;
+    void setMaxBytes(size_t maxBytes);
+    size_t getMaxBytes() const;
+
+    QueryCacheStats getStats() const;
+
+    // Lowercased, unqualified table names after FROM and JOIN.
+    static std::vector<std::string> readTables(const std::string& query);
+    // Tables a statement modifies. Returns false when that cannot be told
+    // from the text (DDL, function calls, data-modifying CTEs).
+    static bool writtenTables(const std::string& query, std::vector<std::string>& tables);
+
+    // Null unless a cache was installed with setInstance(); connections
+    // pick it up when they are constructed.
+    static std::shared_ptr<QueryCache> getInstance();
+    static void setInstance(std::shared_ptr<QueryCache> instance);
+};
+
+#endif // QUERYCACHE_H
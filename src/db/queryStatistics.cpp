@@ -0,0 +1,216 @@
+#include "queryStatistics.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <iostream>
+
+std::shared_ptr<QueryStatistics> QueryStatistics::instance = nullptr;
+std::mutex QueryStatistics::instanceMutex;
+
+const size_t QueryStatistics::MAX_SAMPLES;
+
+QueryStatistics::QueryStatistics() : enabled(true), slowQueryThresholdMicros(0) {}
+
+void QueryStatistics::record(const std::string& query, std::chrono::microseconds elapsed,
+                             unsigned long long rows, unsigned long long bytes, bool failed) {
+    if (!enabled) {
+        return;
+    }
+
+    std::string key = normalize(query);
+    long long micros = elapsed.count();
+
+    long long threshold = slowQueryThresholdMicros;
+    if (threshold > 0 && micros >= threshold) {
+        char millis[32];
+        std::snprintf(millis, sizeof(millis), "%.3f", micros / 1000.0);
+        std::cerr << "Slow query (" << millis << " ms, " << rows << " rows" << (failed ? ", failed" : "")
+                  << "): " << key << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto inserted = entries.emplace(key, Accumulator());
+    Accumulator& entry = inserted.first->second;
+    if (inserted.second) {
+        entry.calls = 0;
+        entry.errors = 0;
+        entry.totalMicros = 0;
+        entry.minMicros = micros;
+        entry.maxMicros = micros;
+        entry.nextSample = 0;
+        entry.rows = 0;
+        entry.bytes = 0;
+    }
+
+    entry.calls++;
+    if (failed) {
+        entry.errors++;
+    }
+    entry.totalMicros += micros;
+    entry.minMicros = std::min(entry.minMicros, micros);
+    entry.maxMicros = std::max(entry.maxMicros, micros);
+    entry.rows += rows;
+    entry.bytes += bytes;
+
+    if (entry.samples.size() < MAX_SAMPLES) {
+        entry.samples.push_back(micros);
+    } else {
+        entry.samples[entry.nextSample] = micros;
+        entry.nextSample = (entry.nextSample + 1) % MAX_SAMPLES;
+    }
+}
+
+void QueryStatistics::setEnabled(bool enabled) {
+    this->enabled = enabled;
+}
+
+bool QueryStatistics::isEnabled() const {
+    return enabled;
+}
+
+void QueryStatistics::setSlowQueryThreshold(std::chrono::milliseconds threshold) {
+    slowQueryThresholdMicros = threshold.count() * 1000;
+}
+
+std::chrono::milliseconds QueryStatistics::getSlowQueryThreshold() const {
+    return std::chrono::milliseconds(slowQueryThresholdMicros / 1000);
+}
+
+std::vector<QueryStatsEntry> QueryStatistics::snapshot() const {
+    std::vector<QueryStatsEntry> result;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        result.reserve(entries.size());
+
+        for (const auto& pair : entries) {
+            const Accumulator& entry = pair.second;
+            std::vector<long long> sorted = entry.samples;
+            std::sort(sorted.begin(), sorted.end());
+
+            QueryStatsEntry stats;
+            stats.query = pair.first;
+            stats.calls = entry.calls;
+            stats.errors = entry.errors;
+            stats.totalMs = entry.totalMicros / 1000.0;
+            stats.minMs = entry.minMicros / 1000.0;
+            stats.maxMs = entry.maxMicros / 1000.0;
+            stats.p50Ms = sorted.empty() ? 0.0 : sorted[(sorted.size() - 1) / 2] / 1000.0;
+            stats.p99Ms = sorted.empty() ? 0.0 : sorted[(sorted.size() - 1) * 99 / 100] / 1000.0;
+            stats.rows = entry.rows;
+            stats.bytes = entry.bytes;
+            result.push_back(stats);
+        }
+    }
+
+    std::sort(result.begin(), result.end(), [](const QueryStatsEntry& a, const QueryStatsEntry& b) {
+        return a.totalMs > b.totalMs;
+    });
+    return result;
+}
+
+void QueryStatistics::dump(std::ostream& out, size_t limit) const {
+    std::vector<QueryStatsEntry> stats = snapshot();
+
+    out << "=== Query Statistics (" << stats.size() << " statements, by total time) ===\n";
+    char line[160];
+    std::snprintf(line, sizeof(line), "%8s %6s %10s %9s %9s %9s %9s %9s %10s\n",
+                  "calls", "errors", "total ms", "min ms", "p50 ms", "p99 ms", "max ms", "rows", "bytes");
+    out << line;
+
+    for (size_t i = 0; i < stats.size() && (limit == 0 || i < limit); i++) {
+        const QueryStatsEntry& entry = stats[i];
+        std::snprintf(line, sizeof(line), "%8llu %6llu %10.2f %9.3f %9.3f %9.3f %9.3f %9llu %10llu\n",
+                      entry.calls, entry.errors, entry.totalMs, entry.minMs, entry.p50Ms,
+                      entry.p99Ms, entry.maxMs, entry.rows, entry.bytes);
+        out << line << "    " << entry.query << "\n";
+    }
+    out.flush();
+}
+
+void QueryStatistics::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+std::string QueryStatistics::normalize(const std::string& query) {
+    std::string normalized;
+    normalized.reserve(query.size());
+
+    auto isIdentifierChar = [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+    };
+
+    size_t i = 0;
+    while (i < query.size()) {
+        char c = query[i];
+
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            while (i < query.size() && std::isspace(static_cast<unsigned char>(query[i]))) {
+                i++;
+            }
+            if (!normalized.empty() && i < query.size()) {
+                normalized += ' ';
+            }
+            continue;
+        }
+
+        if (c == '\'') {
+            // String literal; '' is an escaped quote inside it.
+            i++;
+            while (i < query.size()) {
+                if (query[i] == '\'' && i + 1 < query.size() && query[i + 1] == '\'') {
+                    i += 2;
+                } else if (query[i] == '\'') {
+                    i++;
+                    break;
+                } else {
+                    i++;
+                }
+            }
+            normalized += '?';
+            continue;
+        }
+
+        if (c == '"') {
+            size_t end = query.find('"', i + 1);
+            end = end == std::string::npos ? query.size() : end + 1;
+            normalized.append(query, i, end - i);
+            i = end;
+            continue;
+        }
+
+        if (std::isdigit(static_cast<unsigned char>(c)) &&
+            (normalized.empty() || !isIdentifierChar(normalized.back()))) {
+            while (i < query.size() && (std::isdigit(static_cast<unsigned char>(query[i])) || query[i] == '.')) {
+                i++;
+            }
+            normalized += '?';
+            continue;
+        }
+
+        if (isIdentifierChar(c)) {
+            while (i < query.size() && isIdentifierChar(query[i])) {
+                normalized += query[i++];
+            }
+            continue;
+        }
+
+        normalized += c;
+        i++;
+    }
+
+    return normalized;
+}
+
+std::shared_ptr<QueryStatistics> QueryStatistics::getInstance() {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    if (!instance) {
+        instance = std::make_shared<QueryStatistics>();
+    }
+    return instance;
+}
+
+void QueryStatistics::setInstance(std::shared_ptr<QueryStatistics> instance) {
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    QueryStatistics::instance = instance;
+}
@@ -0,0 +1,78 @@
+#ifndef QUERYSTATISTICS_H
+#define QUERYSTATISTICS_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct QueryStatsEntry {
+    std::string query;
+    unsigned long long calls;
+    unsigned long long errors;
+    double totalMs;
+    double minMs;
+    double maxMs;
+    double p50Ms;
+    double p99Ms;
+    unsigned long long rows;
+    unsigned long long bytes;
+};
+
+// Per-statement latency and volume counters, keyed by normalized query text
+// (literals replaced by '?', whitespace collapsed). Shared by every
+// connection in the process and safe to record into from multiple threads.
+class QueryStatistics {
+private:
+    // Percentiles are computed from the most recent samples only.
+    static const size_t MAX_SAMPLES = 1024;
+
+    struct Accumulator {
+        unsigned long long calls;
+        unsigned long long errors;
+        long long totalMicros;
+        long long minMicros;
+        long long maxMicros;
+        std::vector<long long> samples;
+        size_t nextSample;
+        unsigned long long rows;
+        unsigned long long bytes;
+    };
+
+    std::unordered_map<std::string, Accumulator> entries;
+    mutable std::mutex mutex;
+    std::atomic<bool> enabled;
+    std::atomic<long long> slowQueryThresholdMicros;
+
+    static std::shared_ptr<QueryStatistics> instance;
+    static std::mutex instanceMutex;
+
+public:
+    QueryStatistics();
+
+    void record(const std::string& query, std::chrono::microseconds elapsed,
+                unsigned long long rows, unsigned long long bytes, bool failed);
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    // Statements at or above the threshold are logged to std::cerr as they
+    // complete. Zero disables the slow-query log.
+    void setSlowQueryThreshold(std::chrono::milliseconds threshold);
+    std::chrono::milliseconds getSlowQueryThreshold() const;
+
+    std::vector<QueryStatsEntry> snapshot() const;
+    void dump(std::ostream& out, size_t limit = 20) const;
+    void reset();
+
+    static std::string normalize(const std::string& query);
+
+    static std::shared_ptr<QueryStatistics> getInstance();
+    static void setInstance(std::shared_ptr<QueryStatistics> instance);
+};
+
+#endif // QUERYSTATISTICS_H
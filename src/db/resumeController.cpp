@@ -3,7 +3,28 @@
 #include <sstream>
 #include <memory>
 
-ResumeController::ResumeController() : BaseController() {}
+ResumeController::ResumeController() : rowMapper(columnBindings()) {}
+
+ResumeController::ResumeController(std::shared_ptr<ConnectionPool> pool)
+    : DatabaseClient(pool), rowMapper(columnBindings()) {}
+
+ResumeController::ResumeController(std::shared_ptr<ConnectionRouter> router)
+    : DatabaseClient(router), rowMapper(columnBindings()) {}
+
+const RowMapper<Resume>::Bindings& ResumeController::columnBindings() {
+    using Column = ColumnBinding<Resume>;
+    static const RowMapper<Resume>::Bindings bindings = {
+        Column::field<&Resume::setId, &Resume::getId>("id", COLUMN_READ),
+        Column::field<&Resume::setName, &Resume::getName>("name"),
+        Column::field<&Resume::setEmail, &Resume::getEmail>("email"),
+        Column::field<&Resume::setCity, &Resume::getCity>("city"),
+        Column::field<&Resume::setPhone, &Resume::getPhone>("phone"),
+        Column::field<&Resume::setLinkedin, &Resume::getLinkedin>("linkedin"),
+        Column::field<&Resume::setWebsite, &Resume::getWebsite>("website"),
+        Column::field<&Resume::setInterests, &Resume::getInterests>("interests")
+    };
+    return bindings;
+}
 
 bool ResumeController::createResume(const Resume& resume) {
     if (!initializeDatabase()) {
@@ -19,21 +40,13 @@ bool ResumeController::createResume(const Resume& resume) {
         return false;
     }
 
-    std::string query = R"(
-        INSERT INTO resumes (name, email, city, phone, linkedin, website, interests)
-        VALUES ($1, $2, $3, $4, $5, $6, $7)
-        RETURNING id
-    )";
+    using Mapper = RowMapper<Resume>;
+    static const std::string query =
+        "INSERT INTO resumes (" + Mapper::columnList(columnBindings(), COLUMN_INSERT) +
+        ") VALUES (" + Mapper::placeholderList(columnBindings(), COLUMN_INSERT) + ") RETURNING id";
 
-    std::vector<std::string> params = {
-        resume.getName(),
-        resume.getEmail(),
-        resume.getCity(),
-        resume.getPhone(),
-        resume.getLinkedin(),
-        resume.getWebsite(),
-        resume.getInterests()
-    };
+    std::vector<std::string> params;
+    Mapper::appendParams(columnBindings(), COLUMN_INSERT, resume, params);
 
     PGresult* result = db->executeParameterizedQuery(query, params);
     if (!result) {
@@ -63,14 +76,12 @@ bool ResumeController::createResume(const Resume& resume) {
 }
 
 std::unique_ptr<Resume> ResumeController::getResumeById(int resumeId) {
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return nullptr;
     }
 
     std::string query = "SELECT * FROM resumes WHERE id = $1";
-    std::vector<std::string> params = {std::to_string(resumeId)};
-
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->execute(query, resumeId);
     if (!result) {
         return nullptr;
     }
@@ -95,14 +106,14 @@ std::unique_ptr<Resume> ResumeController::getResumeById(int resumeId) {
 }
 
 std::unique_ptr<Resume> ResumeController::getResumeByEmail(const std::string& email) {
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return nullptr;
     }
 
     std::string query = "SELECT * FROM resumes WHERE email = $1";
     std::vector<std::string> params = {email};
 
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->executeParameterizedQuery(query, params);
     if (!result) {
         return nullptr;
     }
@@ -128,12 +139,12 @@ std::unique_ptr<Resume> ResumeController::getResumeByEmail(const std::string& em
 std::vector<std::unique_ptr<Resume>> ResumeController::getAllResumes() {
     std::vector<std::unique_ptr<Resume>> resumes;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return resumes;
     }
 
     std::string query = "SELECT * FROM resumes ORDER BY created_at DESC";
-    PGresult* result = db->executeQuery(query);
+    PGresult* result = readDb->executeQuery(query);
 
     if (!result) {
         return resumes;
@@ -158,14 +169,14 @@ std::vector<std::unique_ptr<Resume>> ResumeController::getAllResumes() {
 std::vector<std::unique_ptr<Resume>> ResumeController::getResumesByName(const std::string& name) {
     std::vector<std::unique_ptr<Resume>> resumes;
 
-    if (!initializeDatabase()) {
+    if (!initializeReadDatabase()) {
         return resumes;
     }
 
     std::string query = "SELECT * FROM resumes WHERE LOWER(name) LIKE LOWER($1) ORDER BY created_at DESC";
     std::vector<std::string> params = {"%" + name + "%"};
 
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = readDb->executeParameterizedQuery(query, params);
     if (!result) {
         return resumes;
     }
@@ -200,24 +211,13 @@ bool ResumeController::updateResume(const Resume& resume) {
         return false;
     }
 
-    std::string query = R"(
-        UPDATE resumes SET
-            name = $2, email = $3, city = $4, phone = $5,
-            linkedin = $6, website = $7, interests = $8,
-            updated_at = CURRENT_TIMESTAMP
-        WHERE id = $1
-    )";
+    using Mapper = RowMapper<Resume>;
+    static const std::string query =
+        "UPDATE resumes SET " + Mapper::assignmentList(columnBindings(), COLUMN_UPDATE, 2) +
+        ", updated_at = CURRENT_TIMESTAMP WHERE id = $1";
 
-    std::vector<std::string> params = {
-        std::to_string(resume.getId()),
-        resume.getName(),
-        resume.getEmail(),
-        resume.getCity(),
-        resume.getPhone(),
-        resume.getLinkedin(),
-        resume.getWebsite(),
-        resume.getInterests()
-    };
+    std::vector<std::string> params = {std::to_string(resume.getId())};
+    Mapper::appendParams(columnBindings(), COLUMN_UPDATE, resume, params);
 
     bool success = db->executeParameterizedNonQuery(query, params);
 
@@ -275,8 +275,7 @@ bool ResumeController::deleteResume(int resumeId) {
 
     if (success) {
         std::string query = "DELETE FROM resumes WHERE id = $1";
-        std::vector<std::string> params = {std::to_string(resumeId)};
-        success = db->executeParameterizedNonQuery(query, params);
+        success = db->executeNonQuery(query, resumeId);
     }
 
     if (success) {
@@ -302,12 +301,12 @@ bool ResumeController::deleteResumeByEmail(const std::string& email) {
 }
 
 int ResumeController::getResumeCount() const {
-    if (!const_cast<ResumeController*>(this)->initializeDatabase()) {
+    if (!const_cast<ResumeController*>(this)->initializeReadDatabase()) {
         return 0;
     }
 
     std::string query = "SELECT COUNT(*) FROM resumes";
-    PGresult* result = db->executeQuery(query);
+    PGresult* result = readDb->executeQuery(query);
 
     if (!result) {
         return 0;
@@ -369,9 +368,7 @@ bool ResumeController::resumeExists(int resumeId) const {
     }
 
     std::string query = "SELECT COUNT(*) FROM resumes WHERE id = $1";
-    std::vector<std::string> params = {std::to_string(resumeId)};
-
-    PGresult* result = db->executeParameterizedQuery(query, params);
+    PGresult* result = db->execute(query, resumeId);
     if (!result) {
         return false;
     }
@@ -407,16 +404,7 @@ bool ResumeController::resumeExistsByEmail(const std::string& email) const {
 
 Resume* ResumeController::mapResultToResume(DatabaseResult& result) {
     Resume* resume = new Resume();
-
-    resume->setId(result.getInt("id"));
-    resume->setName(result.getString("name"));
-    resume->setEmail(result.getString("email"));
-    resume->setCity(result.getString("city"));
-    resume->setPhone(result.getString("phone"));
-    resume->setLinkedin(result.getString("linkedin"));
-    resume->setWebsite(result.getString("website"));
-    resume->setInterests(result.getString("interests"));
-
+    rowMapper.map(result, *resume);
     return resume;
 }
 
@@ -434,20 +422,17 @@ bool ResumeController::insertResumeExperiences(int resumeId, const Experiences&
 
 bool ResumeController::deleteResumeSkills(int resumeId) {
     std::string query = "DELETE FROM resume_skills WHERE resume_id = $1";
-    std::vector<std::string> params = {std::to_string(resumeId)};
-    return db->executeParameterizedNonQuery(query, params);
+    return db->executeNonQuery(query, resumeId);
 }
 
 bool ResumeController::deleteResumeEducation(int resumeId) {
     std::string query = "DELETE FROM resume_education WHERE resume_id = $1";
-    std::vector<std::string> params = {std::to_string(resumeId)};
-    return db->executeParameterizedNonQuery(query, params);
+    return db->executeNonQuery(query, resumeId);
 }
 
 bool ResumeController::deleteResumeExperiences(int resumeId) {
     std::string query = "DELETE FROM resume_experiences WHERE resume_id = $1";
-    std::vector<std::string> params = {std::to_string(resumeId)};
-    return db->executeParameterizedNonQuery(query, params);
+    return db->executeNonQuery(query, resumeId);
 }
 
 Skills ResumeController::getResumeSkills(int resumeId) {
@@ -2,15 +2,24 @@
 #define RESUMECONTROLLER_H
 
 #include "baseController.h"
+#include "rowMapper.h"
 #include "../ds/resume/resume.h"
 #include <vector>
 #include <memory>
 
-class ResumeController : public BaseController {
+class ResumeController : public BaseController, public DatabaseClient {
+private:
+    RowMapper<Resume> rowMapper;
+
 public:
     ResumeController();
+    explicit ResumeController(std::shared_ptr<ConnectionPool> pool);
+    explicit ResumeController(std::shared_ptr<ConnectionRouter> router);
     ~ResumeController() = default;
 
+    // Column <-> member bindings for the table this controller owns.
+    static const RowMapper<Resume>::Bindings& columnBindings();
+
     bool createResume(const Resume& resume);
     std::unique_ptr<Resume> getResumeById(int resumeId);
     std::unique_ptr<Resume> getResumeByEmail(const std::string& email);
@@ -0,0 +1,191 @@
+#ifndef ROWMAPPER_H
+#define ROWMAPPER_H
+
+#include "database.h"
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Which statements a bound column takes part in.
+enum ColumnUsage : unsigned {
+    COLUMN_READ = 1,
+    COLUMN_INSERT = 2,
+    COLUMN_UPDATE = 4,
+    COLUMN_ALL = COLUMN_READ | COLUMN_INSERT | COLUMN_UPDATE
+};
+
+// Converts between a column value and a member type: strings, integers,
+// floating point, bool and int-backed enums.
+template <typename V>
+struct ColumnValue {
+    static V read(const DatabaseResult& row, int fieldIndex) {
+        if constexpr (std::is_enum<V>::value) {
+            return static_cast<V>(row.getInt(fieldIndex));
+        } else if constexpr (std::is_same<V, bool>::value) {
+            return row.getBool(fieldIndex);
+        } else if constexpr (std::is_integral<V>::value) {
+            return static_cast<V>(row.getInt64(fieldIndex));
+        } else if constexpr (std::is_floating_point<V>::value) {
+            return static_cast<V>(row.getDouble(fieldIndex));
+        } else {
+            return V(row.getStringView(fieldIndex));
+        }
+    }
+
+    static std::string write(V value) {
+        if constexpr (std::is_enum<V>::value) {
+            return std::to_string(static_cast<int>(value));
+        } else if constexpr (std::is_same<V, bool>::value) {
+            return value ? "true" : "false";
+        } else if constexpr (std::is_arithmetic<V>::value) {
+            return std::to_string(value);
+        } else {
+            return value;
+        }
+    }
+};
+
+template <typename Setter>
+struct SetterTraits;
+
+template <typename C, typename A>
+struct SetterTraits<void (C::*)(A)> {
+    using Value = typename std::decay<A>::type;
+};
+
+template <typename Getter>
+struct GetterTraits;
+
+template <typename C, typename R>
+struct GetterTraits<R (C::*)() const> {
+    using Value = typename std::decay<R>::type;
+};
+
+// A table column bound to a setter/getter pair on T.
+template <typename T>
+struct ColumnBinding {
+    const char* column;
+    unsigned usage;
+    void (*read)(T& object, const DatabaseResult& row, int fieldIndex);
+    std::string (*write)(const T& object);
+
+    template <auto Setter, auto Getter>
+    static ColumnBinding field(const char* column, unsigned usage = COLUMN_ALL) {
+        return ColumnBinding{column, usage, &readInto<Setter>, &writeFrom<Getter>};
+    }
+
+    template <auto Setter>
+    static void readInto(T& object, const DatabaseResult& row, int fieldIndex) {
+        using Value = typename SetterTraits<decltype(Setter)>::Value;
+        (object.*Setter)(ColumnValue<Value>::read(row, fieldIndex));
+    }
+
+    template <auto Getter>
+    static std::string writeFrom(const T& object) {
+        using Value = typename GetterTraits<decltype(Getter)>::Value;
+        return ColumnValue<Value>::write((object.*Getter)());
+    }
+};
+
+// Hydrates T from result rows through a binding table. Column positions are
+// resolved once per result shape (so once per streamed query) and reused
+// for every row. The same table renders INSERT/UPDATE column and parameter
+// lists, so reads and writes cannot drift apart.
+template <typename T>
+class RowMapper {
+public:
+    using Bindings = std::vector<ColumnBinding<T>>;
+
+private:
+    const Bindings& bindings;
+    std::shared_ptr<const ResultColumns> resolvedColumns;
+    std::vector<int> fieldIndexes;
+
+    void resolve(const DatabaseResult& row) {
+        std::shared_ptr<const ResultColumns> columns = row.getColumns();
+        if (columns == resolvedColumns) {
+            return;
+        }
+
+        resolvedColumns = columns;
+        fieldIndexes.clear();
+        for (const auto& binding : bindings) {
+            fieldIndexes.push_back((binding.usage & COLUMN_READ) ? columns->indexOf(binding.column) : -1);
+        }
+    }
+
+public:
+    explicit RowMapper(const Bindings& bindings) : bindings(bindings) {}
+
+    // Fills the bound members of `object` from the current row. Columns the
+    // result does not have are left untouched.
+    void map(const DatabaseResult& row, T& object) {
+        resolve(row);
+        for (size_t i = 0; i < bindings.size(); i++) {
+            if (fieldIndexes[i] >= 0) {
+                bindings[i].read(object, row, fieldIndexes[i]);
+            }
+        }
+    }
+
+    std::unique_ptr<T> map(const DatabaseResult& row) {
+        std::unique_ptr<T> object(new T());
+        map(row, *object);
+        return object;
+    }
+
+    // "a, b, c" for the columns with `usage`.
+    static std::string columnList(const Bindings& bindings, unsigned usage) {
+        std::string list;
+        for (const auto& binding : bindings) {
+            if (binding.usage & usage) {
+                if (!list.empty()) {
+                    list += ", ";
+                }
+                list += binding.column;
+            }
+        }
+        return list;
+    }
+
+    // "$first, $first+1, ..." matching columnList().
+    static std::string placeholderList(const Bindings& bindings, unsigned usage, int first = 1) {
+        std::string list;
+        for (const auto& binding : bindings) {
+            if (binding.usage & usage) {
+                if (!list.empty()) {
+                    list += ", ";
+                }
+                list += "$" + std::to_string(first++);
+            }
+        }
+        return list;
+    }
+
+    // "a = $first, b = $first+1, ..." for an UPDATE ... SET clause.
+    static std::string assignmentList(const Bindings& bindings, unsigned usage, int first = 1) {
+        std::string list;
+        for (const auto& binding : bindings) {
+            if (binding.usage & usage) {
+                if (!list.empty()) {
+                    list += ", ";
+                }
+                list += std::string(binding.column) + " = $" + std::to_string(first++);
+            }
+        }
+        return list;
+    }
+
+    // Parameter values in columnList() order, appended to `params`.
+    static void appendParams(const Bindings& bindings, unsigned usage, const T& object,
+                             std::vector<std::string>& params) {
+        for (const auto& binding : bindings) {
+            if (binding.usage & usage) {
+                params.push_back(binding.write(object));
+            }
+        }
+    }
+};
+
+#endif // ROWMAPPER_H
@@ -157,11 +157,14 @@ CREATE TABLE job_preferred_skills (
 CREATE INDEX idx_resumes_email ON resumes(email);
 CREATE INDEX idx_job_listings_job_id ON job_listings(job_id);
 CREATE INDEX idx_job_listings_company ON job_listings(company);
+CREATE INDEX idx_job_listings_posted_date ON job_listings(posted_date, id);
+CREATE INDEX idx_job_listings_salary_max ON job_listings(salary_max, id);
 CREATE INDEX idx_job_applications_application_id ON job_applications(application_id);
 CREATE INDEX idx_job_applications_job_id ON job_applications(job_id);
 CREATE INDEX idx_job_applications_company ON job_applications(company);
-CREATE INDEX idx_job_applications_status ON job_applications(status);
-CREATE INDEX idx_job_applications_date_applied ON job_applications(date_applied);
+CREATE INDEX idx_job_applications_status ON job_applications(status, date_applied, id);
+CREATE INDEX idx_job_applications_date_applied ON job_applications(date_applied, id);
+CREATE INDEX idx_job_applications_referral_source ON job_applications(LOWER(referral_source));
 CREATE INDEX idx_interview_dates_application_id ON interview_dates(application_id);
 CREATE INDEX idx_followup_dates_application_id ON followup_dates(application_id);
 
@@ -181,4 +184,46 @@ CREATE TRIGGER update_job_listings_updated_at BEFORE UPDATE ON job_listings
     FOR EACH ROW EXECUTE FUNCTION update_updated_at_column();
 
 CREATE TRIGGER update_job_applications_updated_at BEFORE UPDATE ON job_applications
-    FOR EACH ROW EXECUTE FUNCTION update_updated_at_column();
\ No newline at end of file
+    FOR EACH ROW EXECUTE FUNCTION update_updated_at_column();
+
+-- Announce table changes so processes caching query results can drop them.
+-- Fires once per statement with the table name as payload; Postgres folds
+-- identical notifications within a transaction, so a bulk load sends one
+-- message per table instead of one per row.
+CREATE OR REPLACE FUNCTION notify_table_change()
+RETURNS TRIGGER AS $$
+BEGIN
+    PERFORM pg_notify('rezz_table_changes', TG_TABLE_NAME);
+    RETURN NULL;
+END;
+$$ language 'plpgsql';
+
+CREATE TRIGGER notify_resumes_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON resumes
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_job_listings_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON job_listings
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_job_applications_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON job_applications
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_interview_dates_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON interview_dates
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_followup_dates_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON followup_dates
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_resume_skills_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON resume_skills
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_resume_education_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON resume_education
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_resume_experiences_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON resume_experiences
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_job_required_skills_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON job_required_skills
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
+
+CREATE TRIGGER notify_job_preferred_skills_change AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON job_preferred_skills
+    FOR EACH STATEMENT EXECUTE FUNCTION notify_table_change();
\ No newline at end of file
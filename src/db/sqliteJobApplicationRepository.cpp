@@ -0,0 +1,537 @@
+#include "sqliteJobApplicationRepository.h"
+#include <iostream>
+
+// schema.sql's application tables in SQLite types. job_id has no foreign key
+// because job listings are not stored here. The composite indexes cover
+// the ORDER BY of every list query and child-date lookup.
+static const char* const SCHEMA = R"(
+CREATE TABLE IF NOT EXISTS job_applications (
+    id INTEGER PRIMARY KEY,
+    application_id TEXT UNIQUE NOT NULL,
+    job_id TEXT,
+    job_title TEXT NOT NULL,
+    company TEXT NOT NULL,
+    date_applied TEXT NOT NULL,
+    status INTEGER DEFAULT 1,
+    contact_name TEXT,
+    contact_email TEXT,
+    contact_phone TEXT,
+    comments TEXT,
+    application_url TEXT,
+    salary_offered TEXT,
+    expected_salary TEXT,
+    response_deadline TEXT,
+    referral_source TEXT,
+    application_method TEXT,
+    notes TEXT,
+    created_at TEXT DEFAULT CURRENT_TIMESTAMP,
+    updated_at TEXT DEFAULT CURRENT_TIMESTAMP
+);
+
+CREATE TABLE IF NOT EXISTS interview_dates (
+    id INTEGER PRIMARY KEY,
+    application_id TEXT NOT NULL REFERENCES job_applications(application_id) ON DELETE CASCADE,
+    interview_date TEXT NOT NULL,
+    created_at TEXT DEFAULT CURRENT_TIMESTAMP
+);
+
+CREATE TABLE IF NOT EXISTS followup_dates (
+    id INTEGER PRIMARY KEY,
+    application_id TEXT NOT NULL REFERENCES job_applications(application_id) ON DELETE CASCADE,
+    followup_date TEXT NOT NULL,
+    created_at TEXT DEFAULT CURRENT_TIMESTAMP
+);
+
+CREATE INDEX IF NOT EXISTS idx_job_applications_job_id ON job_applications(job_id);
+CREATE INDEX IF NOT EXISTS idx_job_applications_company ON job_applications(company);
+CREATE INDEX IF NOT EXISTS idx_job_applications_date_applied ON job_applications(date_applied, application_id);
+CREATE INDEX IF NOT EXISTS idx_job_applications_status ON job_applications(status, date_applied, application_id);
+CREATE INDEX IF NOT EXISTS idx_interview_dates_application_id ON interview_dates(application_id, interview_date);
+CREATE INDEX IF NOT EXISTS idx_followup_dates_application_id ON followup_dates(application_id, followup_date);
+)";
+
+// Text columns in SELECT/INSERT order; status follows them.
+struct TextColumn {
+    const char* name;
+    std::string (JobApplication::*get)() const;
+    void (JobApplication::*set)(std::string);
+};
+
+static const TextColumn TEXT_COLUMNS[] = {
+    {"application_id", &JobApplication::getApplicationId, &JobApplication::setApplicationId},
+    {"job_id", &JobApplication::getJobId, &JobApplication::setJobId},
+    {"job_title", &JobApplication::getJobTitle, &JobApplication::setJobTitle},
+    {"company", &JobApplication::getCompany, &JobApplication::setCompany},
+    {"date_applied", &JobApplication::getDateApplied, &JobApplication::setDateApplied},
+    {"contact_name", &JobApplication::getContactName, &JobApplication::setContactName},
+    {"contact_email", &JobApplication::getContactEmail, &JobApplication::setContactEmail},
+    {"contact_phone", &JobApplication::getContactPhone, &JobApplication::setContactPhone},
+    {"comments", &JobApplication::getComments, &JobApplication::setComments},
+    {"application_url", &JobApplication::getApplicationUrl, &JobApplication::setApplicationUrl},
+    {"salary_offered", &JobApplication::getSalaryOffered, &JobApplication::setSalaryOffered},
+    {"expected_salary", &JobApplication::getExpectedSalary, &JobApplication::setExpectedSalary},
+    {"response_deadline", &JobApplication::getResponseDeadline, &JobApplication::setResponseDeadline},
+    {"referral_source", &JobApplication::getReferralSource, &JobApplication::setReferralSource},
+    {"application_method", &JobApplication::getApplicationMethod, &JobApplication::setApplicationMethod},
+    {"notes", &JobApplication::getNotes, &JobApplication::setNotes}
+};
+
+static const int TEXT_COLUMN_COUNT = sizeof(TEXT_COLUMNS) / sizeof(TEXT_COLUMNS[0]);
+static const int STATUS_COLUMN = TEXT_COLUMN_COUNT;
+
+static std::string columnList() {
+    std::string columns;
+    for (const auto& column : TEXT_COLUMNS) {
+        columns += column.name;
+        columns += ", ";
+    }
+    return columns + "status";
+}
+
+static const char* const INSERT_INTERVIEW_DATE =
+    "INSERT INTO interview_dates (application_id, interview_date) VALUES (?, ?)";
+static const char* const INSERT_FOLLOWUP_DATE =
+    "INSERT INTO followup_dates (application_id, followup_date) VALUES (?, ?)";
+static const char* const SELECT_INTERVIEW_DATES =
+    "SELECT interview_date FROM interview_dates WHERE application_id = ? ORDER BY interview_date";
+static const char* const SELECT_FOLLOWUP_DATES =
+    "SELECT followup_date FROM followup_dates WHERE application_id = ? ORDER BY followup_date";
+
+SqliteJobApplicationRepository::StatementUse::~StatementUse() {
+    if (stmt) {
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+    }
+}
+
+SqliteJobApplicationRepository::SqliteJobApplicationRepository(const std::string& path)
+    : path(path), db(nullptr), transactionDepth(0), transactionFailed(false) {}
+
+SqliteJobApplicationRepository::~SqliteJobApplicationRepository() {
+    close();
+}
+
+bool SqliteJobApplicationRepository::open() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (db) {
+        return true;
+    }
+
+    // The mutex above serializes access, so SQLite's own can go.
+    int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX;
+    if (sqlite3_open_v2(path.c_str(), &db, flags, nullptr) != SQLITE_OK) {
+        std::cerr << "Failed to open SQLite database " << path << ": " << sqlite3_errmsg(db) << std::endl;
+        sqlite3_close(db);
+        db = nullptr;
+        return false;
+    }
+
+    // WAL lets readers run alongside the writer and turns each commit into
+    // one sequential append; NORMAL skips the fsync per commit, which WAL
+    // makes safe against application crashes.
+    sqlite3_busy_timeout(db, 5000);
+    if (!exec("PRAGMA journal_mode = WAL") ||
+        !exec("PRAGMA synchronous = NORMAL") ||
+        !exec("PRAGMA foreign_keys = ON") ||
+        !createSchema()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void SqliteJobApplicationRepository::close() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    for (auto& entry : statements) {
+        sqlite3_finalize(entry.second);
+    }
+    statements.clear();
+    transactionDepth = 0;
+
+    if (db) {
+        sqlite3_close(db);
+        db = nullptr;
+    }
+}
+
+bool SqliteJobApplicationRepository::isOpen() const {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return db != nullptr;
+}
+
+bool SqliteJobApplicationRepository::createSchema() {
+    return exec(SCHEMA);
+}
+
+sqlite3_stmt* SqliteJobApplicationRepository::statement(const std::string& sql) const {
+    if (!db) {
+        std::cerr << "SQLite database is not open" << std::endl;
+        return nullptr;
+    }
+
+    auto cached = statements.find(sql);
+    if (cached != statements.end()) {
+        return cached->second;
+    }
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v3(db, sql.c_str(), -1, SQLITE_PREPARE_PERSISTENT, &stmt, nullptr) != SQLITE_OK) {
+        std::cerr << "SQLite prepare failed: " << sqlite3_errmsg(db) << std::endl;
+        return nullptr;
+    }
+    statements.emplace(sql, stmt);
+    return stmt;
+}
+
+bool SqliteJobApplicationRepository::exec(const char* sql) const {
+    char* error = nullptr;
+    if (sqlite3_exec(db, sql, nullptr, nullptr, &error) != SQLITE_OK) {
+        std::cerr << "SQLite error: " << (error ? error : sqlite3_errmsg(db)) << std::endl;
+        sqlite3_free(error);
+        return false;
+    }
+    return true;
+}
+
+bool SqliteJobApplicationRepository::step(sqlite3_stmt* stmt) const {
+    int rc = sqlite3_step(stmt);
+    if (rc != SQLITE_DONE && rc != SQLITE_ROW) {
+        std::cerr << "SQLite error: " << sqlite3_errmsg(db) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SqliteJobApplicationRepository::begin() {
+    if (!db) {
+        std::cerr << "SQLite database is not open" << std::endl;
+        return false;
+    }
+    if (transactionDepth++ > 0) {
+        return true;
+    }
+
+    // IMMEDIATE takes the write lock up front, so a transaction never fails
+    // halfway through on a lock upgrade.
+    transactionFailed = false;
+    if (!exec("BEGIN IMMEDIATE")) {
+        transactionDepth = 0;
+        return false;
+    }
+    return true;
+}
+
+bool SqliteJobApplicationRepository::end(bool success) {
+    if (!success) {
+        transactionFailed = true;
+    }
+    if (--transactionDepth > 0) {
+        return success;
+    }
+
+    if (transactionFailed) {
+        exec("ROLLBACK");
+        return false;
+    }
+    return exec("COMMIT");
+}
+
+bool SqliteJobApplicationRepository::runInTransaction(const std::function<bool()>& work) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (!begin()) {
+        return false;
+    }
+    return end(work());
+}
+
+void SqliteJobApplicationRepository::bindText(sqlite3_stmt* stmt, int index, const std::string& value) {
+    sqlite3_bind_text(stmt, index, value.data(), static_cast<int>(value.size()), SQLITE_TRANSIENT);
+}
+
+std::string SqliteJobApplicationRepository::columnText(sqlite3_stmt* stmt, int index) {
+    const unsigned char* text = sqlite3_column_text(stmt, index);
+    if (!text) {
+        return "";
+    }
+    return std::string(reinterpret_cast<const char*>(text), sqlite3_column_bytes(stmt, index));
+}
+
+bool SqliteJobApplicationRepository::insertApplication(const JobApplication& application) {
+    static const std::string sql = [] {
+        std::string placeholders;
+        for (int i = 0; i <= TEXT_COLUMN_COUNT; i++) {
+            placeholders += i == 0 ? "?" : ", ?";
+        }
+        return "INSERT INTO job_applications (" + columnList() + ") VALUES (" + placeholders + ")";
+    }();
+
+    StatementUse stmt(statement(sql));
+    if (!stmt) {
+        return false;
+    }
+    for (int i = 0; i < TEXT_COLUMN_COUNT; i++) {
+        bindText(stmt.get(), i + 1, (application.*TEXT_COLUMNS[i].get)());
+    }
+    sqlite3_bind_int(stmt.get(), STATUS_COLUMN + 1, static_cast<int>(application.getStatus()));
+    return step(stmt.get()) &&
+           insertDates(INSERT_INTERVIEW_DATE, application.getApplicationId(), application.getInterviewDates()) &&
+           insertDates(INSERT_FOLLOWUP_DATE, application.getApplicationId(), application.getFollowUpDates());
+}
+
+bool SqliteJobApplicationRepository::insertDates(const char* sql, const std::string& applicationId,
+                                                 const std::vector<std::string>& dates) {
+    if (dates.empty()) {
+        return true;
+    }
+
+    StatementUse stmt(statement(sql));
+    if (!stmt) {
+        return false;
+    }
+    for (const auto& date : dates) {
+        bindText(stmt.get(), 1, applicationId);
+        bindText(stmt.get(), 2, date);
+        if (!step(stmt.get())) {
+            return false;
+        }
+        sqlite3_reset(stmt.get());
+    }
+    return true;
+}
+
+bool SqliteJobApplicationRepository::deleteDates(const std::string& applicationId) {
+    StatementUse interviews(statement("DELETE FROM interview_dates WHERE application_id = ?"));
+    StatementUse followUps(statement("DELETE FROM followup_dates WHERE application_id = ?"));
+    if (!interviews || !followUps) {
+        return false;
+    }
+    bindText(interviews.get(), 1, applicationId);
+    bindText(followUps.get(), 1, applicationId);
+    return step(interviews.get()) && step(followUps.get());
+}
+
+JobApplication SqliteJobApplicationRepository::readApplication(sqlite3_stmt* stmt) {
+    JobApplication application;
+    for (int i = 0; i < TEXT_COLUMN_COUNT; i++) {
+        (application.*TEXT_COLUMNS[i].set)(columnText(stmt, i));
+    }
+    application.setStatus(static_cast<ApplicationStatus>(sqlite3_column_int(stmt, STATUS_COLUMN)));
+
+    // Each lookup is an index seek in this process, not a round trip, so
+    // per-row child queries cost microseconds here.
+    for (const auto& date : loadDates(SELECT_INTERVIEW_DATES, application.getApplicationId())) {
+        application.addInterviewDate(date);
+    }
+    for (const auto& date : loadDates(SELECT_FOLLOWUP_DATES, application.getApplicationId())) {
+        application.addFollowUpDate(date);
+    }
+    return application;
+}
+
+std::vector<std::string> SqliteJobApplicationRepository::loadDates(const char* sql, const std::string& applicationId) {
+    std::vector<std::string> dates;
+    StatementUse stmt(statement(sql));
+    if (!stmt) {
+        return dates;
+    }
+
+    bindText(stmt.get(), 1, applicationId);
+    while (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+        dates.push_back(columnText(stmt.get(), 0));
+    }
+    return dates;
+}
+
+std::vector<std::unique_ptr<JobApplication>> SqliteJobApplicationRepository::query(
+        const std::string& where, const std::vector<std::string>& params) {
+    std::vector<std::unique_ptr<JobApplication>> result;
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    StatementUse stmt(statement("SELECT " + columnList() + " FROM job_applications " + where +
+                                " ORDER BY date_applied DESC, application_id DESC"));
+    if (!stmt) {
+        return result;
+    }
+    for (size_t i = 0; i < params.size(); i++) {
+        bindText(stmt.get(), static_cast<int>(i) + 1, params[i]);
+    }
+
+    int rc;
+    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+        result.push_back(std::unique_ptr<JobApplication>(new JobApplication(readApplication(stmt.get()))));
+    }
+    if (rc != SQLITE_DONE) {
+        std::cerr << "SQLite error: " << sqlite3_errmsg(db) << std::endl;
+    }
+    return result;
+}
+
+int SqliteJobApplicationRepository::count(const std::string& sql, const std::vector<std::string>& params) const {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    StatementUse stmt(statement(sql));
+    if (!stmt) {
+        return 0;
+    }
+    for (size_t i = 0; i < params.size(); i++) {
+        bindText(stmt.get(), static_cast<int>(i) + 1, params[i]);
+    }
+    return sqlite3_step(stmt.get()) == SQLITE_ROW ? sqlite3_column_int(stmt.get(), 0) : 0;
+}
+
+bool SqliteJobApplicationRepository::createJobApplication(const JobApplication& application) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (jobApplicationExists(application.getApplicationId())) {
+        std::cerr << "Job application with ID " << application.getApplicationId() << " already exists" << std::endl;
+        return false;
+    }
+
+    if (!begin()) {
+        return false;
+    }
+    return end(insertApplication(application));
+}
+
+std::unique_ptr<JobApplication> SqliteJobApplicationRepository::getJobApplicationById(const std::string& applicationId) {
+    std::vector<std::unique_ptr<JobApplication>> result = query("WHERE application_id = ?", {applicationId});
+    if (result.empty()) {
+        return nullptr;
+    }
+    return std::move(result.front());
+}
+
+std::vector<std::unique_ptr<JobApplication>> SqliteJobApplicationRepository::getAllJobApplications() {
+    return query("", {});
+}
+
+bool SqliteJobApplicationRepository::forEachJobApplication(
+        const std::function<bool(const JobApplication&)>& callback) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    StatementUse stmt(statement("SELECT " + columnList() +
+                                " FROM job_applications ORDER BY date_applied DESC, application_id DESC"));
+    if (!stmt) {
+        return false;
+    }
+
+    int rc;
+    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+        if (!callback(readApplication(stmt.get()))) {
+            return true;
+        }
+    }
+    if (rc != SQLITE_DONE) {
+        std::cerr << "SQLite error: " << sqlite3_errmsg(db) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::vector<std::unique_ptr<JobApplication>> SqliteJobApplicationRepository::getJobApplicationsByCompany(
+        const std::string& company) {
+    return query("WHERE LOWER(company) LIKE LOWER(?)", {"%" + company + "%"});
+}
+
+std::vector<std::unique_ptr<JobApplication>> SqliteJobApplicationRepository::getJobApplicationsByStatus(
+        ApplicationStatus status) {
+    return query("WHERE status = ?", {std::to_string(static_cast<int>(status))});
+}
+
+std::vector<std::unique_ptr<JobApplication>> SqliteJobApplicationRepository::getJobApplicationsByDateRange(
+        const std::string& startDate, const std::string& endDate) {
+    return query("WHERE date_applied BETWEEN ? AND ?", {startDate, endDate});
+}
+
+bool SqliteJobApplicationRepository::updateJobApplication(const JobApplication& application) {
+    static const std::string sql = [] {
+        std::string assignments;
+        for (int i = 1; i < TEXT_COLUMN_COUNT; i++) {
+            assignments += std::string(TEXT_COLUMNS[i].name) + " = ?, ";
+        }
+        return "UPDATE job_applications SET " + assignments +
+               "status = ?, updated_at = CURRENT_TIMESTAMP WHERE application_id = ?";
+    }();
+
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    if (!begin()) {
+        return false;
+    }
+
+    bool success = false;
+    {
+        StatementUse stmt(statement(sql));
+        if (stmt) {
+            for (int i = 1; i < TEXT_COLUMN_COUNT; i++) {
+                bindText(stmt.get(), i, (application.*TEXT_COLUMNS[i].get)());
+            }
+            sqlite3_bind_int(stmt.get(), TEXT_COLUMN_COUNT, static_cast<int>(application.getStatus()));
+            bindText(stmt.get(), TEXT_COLUMN_COUNT + 1, application.getApplicationId());
+            success = step(stmt.get());
+        }
+    }
+    if (success && sqlite3_changes(db) == 0) {
+        std::cerr << "Job application with ID " << application.getApplicationId() << " does not exist" << std::endl;
+        success = false;
+    }
+
+    success = success && deleteDates(application.getApplicationId()) &&
+              insertDates(INSERT_INTERVIEW_DATE, application.getApplicationId(), application.getInterviewDates()) &&
+              insertDates(INSERT_FOLLOWUP_DATE, application.getApplicationId(), application.getFollowUpDates());
+    return end(success);
+}
+
+bool SqliteJobApplicationRepository::updateJobApplicationStatus(const std::string& applicationId,
+                                                                ApplicationStatus status) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    StatementUse stmt(statement(
+        "UPDATE job_applications SET status = ?, updated_at = CURRENT_TIMESTAMP WHERE application_id = ?"));
+    if (!stmt) {
+        return false;
+    }
+    sqlite3_bind_int(stmt.get(), 1, static_cast<int>(status));
+    bindText(stmt.get(), 2, applicationId);
+    return step(stmt.get());
+}
+
+bool SqliteJobApplicationRepository::addInterviewDate(const std::string& applicationId,
+                                                      const std::string& interviewDate) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return insertDates(INSERT_INTERVIEW_DATE, applicationId, {interviewDate});
+}
+
+bool SqliteJobApplicationRepository::addFollowUpDate(const std::string& applicationId,
+                                                     const std::string& followUpDate) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    return insertDates(INSERT_FOLLOWUP_DATE, applicationId, {followUpDate});
+}
+
+bool SqliteJobApplicationRepository::deleteJobApplication(const std::string& applicationId) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    StatementUse stmt(statement("DELETE FROM job_applications WHERE application_id = ?"));
+    if (!stmt) {
+        return false;
+    }
+    bindText(stmt.get(), 1, applicationId);
+    return step(stmt.get());
+}
+
+bool SqliteJobApplicationRepository::deleteJobApplicationsByCompany(const std::string& company) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    StatementUse stmt(statement("DELETE FROM job_applications WHERE LOWER(company) = LOWER(?)"));
+    if (!stmt) {
+        return false;
+    }
+    bindText(stmt.get(), 1, company);
+    return step(stmt.get());
+}
+
+int SqliteJobApplicationRepository::getJobApplicationCount() const {
+    return count("SELECT COUNT(*) FROM job_applications", {});
+}
+
+int SqliteJobApplicationRepository::getJobApplicationCountByStatus(ApplicationStatus status) const {
+    return count("SELECT COUNT(*) FROM job_applications WHERE status = ?",
+                 {std::to_string(static_cast<int>(status))});
+}
+
+bool SqliteJobApplicationRepository::jobApplicationExists(const std::string& applicationId) const {
+    return count("SELECT COUNT(*) FROM job_applications WHERE application_id = ?", {applicationId}) > 0;
+}
@@ -0,0 +1,97 @@
+#ifndef SQLITEJOBAPPLICATIONREPOSITORY_H
+#define SQLITEJOBAPPLICATIONREPOSITORY_H
+
+#include "jobApplicationRepository.h"
+#include <sqlite3.h>
+#include <mutex>
+#include <unordered_map>
+
+// Job applications in an embedded SQLite file, for single-user deployments
+// that should not need a Postgres server. The job_applications,
+// interview_dates and followup_dates tables from schema.sql are created on
+// open(). The database runs in WAL mode so readers never wait for the
+// writer. Every statement is prepared once and reused from a per-connection
+// cache, and each write runs in a single transaction with its child rows.
+// Wrap many writes in runInTransaction() to pay for one commit instead of one
+// per call.
+class SqliteJobApplicationRepository : public JobApplicationRepository {
+private:
+    std::string path;
+    sqlite3* db;
+    mutable std::unordered_map<std::string, sqlite3_stmt*> statements;
+    int transactionDepth;
+    bool transactionFailed;
+    mutable std::recursive_mutex mutex;
+
+    // Resets and unbinds a cached statement when it goes out of scope.
+    class StatementUse {
+    private:
+        sqlite3_stmt* stmt;
+
+    public:
+        explicit StatementUse(sqlite3_stmt* stmt) : stmt(stmt) {}
+        ~StatementUse();
+        StatementUse(const StatementUse&) = delete;
+        StatementUse& operator=(const StatementUse&) = delete;
+        sqlite3_stmt* get() const { return stmt; }
+        explicit operator bool() const { return stmt != nullptr; }
+    };
+
+    sqlite3_stmt* statement(const std::string& sql) const;
+    bool exec(const char* sql) const;
+    bool step(sqlite3_stmt* stmt) const;
+    bool createSchema();
+    bool begin();
+    bool end(bool success);
+
+    static void bindText(sqlite3_stmt* stmt, int index, const std::string& value);
+    static std::string columnText(sqlite3_stmt* stmt, int index);
+    bool insertApplication(const JobApplication& application);
+    bool insertDates(const char* sql, const std::string& applicationId, const std::vector<std::string>& dates);
+    bool deleteDates(const std::string& applicationId);
+    JobApplication readApplication(sqlite3_stmt* stmt);
+    std::vector<std::unique_ptr<JobApplication>> query(const std::string& where, const std::vector<std::string>& params);
+    std::vector<std::string> loadDates(const char* sql, const std::string& applicationId);
+    int count(const std::string& sql, const std::vector<std::string>& params) const;
+
+public:
+    explicit SqliteJobApplicationRepository(const std::string& path);
+    ~SqliteJobApplicationRepository() override;
+
+    SqliteJobApplicationRepository(const SqliteJobApplicationRepository&) = delete;
+    SqliteJobApplicationRepository& operator=(const SqliteJobApplicationRepository&) = delete;
+
+    // Opens (creating if needed) the database file and its schema.
+    // ":memory:" gives a private database that lives as long as this object.
+    bool open();
+    void close();
+    bool isOpen() const;
+
+    // Runs `work` inside one transaction, committing if it returns true and
+    // every write in it succeeded. Nested calls join the outer transaction.
+    bool runInTransaction(const std::function<bool()>& work);
+
+    bool createJobApplication(const JobApplication& application) override;
+    std::unique_ptr<JobApplication> getJobApplicationById(const std::string& applicationId) override;
+    std::vector<std::unique_ptr<JobApplication>> getAllJobApplications() override;
+    // The callback must not call back into the repository.
+    bool forEachJobApplication(const std::function<bool(const JobApplication&)>& callback) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByCompany(const std::string& company) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByStatus(ApplicationStatus status) override;
+    std::vector<std::unique_ptr<JobApplication>> getJobApplicationsByDateRange(const std::string& startDate,
+                                                                              const std::string& endDate) override;
+
+    bool updateJobApplication(const JobApplication& application) override;
+    bool updateJobApplicationStatus(const std::string& applicationId, ApplicationStatus status) override;
+    bool addInterviewDate(const std::string& applicationId, const std::string& interviewDate) override;
+    bool addFollowUpDate(const std::string& applicationId, const std::string& followUpDate) override;
+
+    bool deleteJobApplication(const std::string& applicationId) override;
+    bool deleteJobApplicationsByCompany(const std::string& company) override;
+
+    int getJobApplicationCount() const override;
+    int getJobApplicationCountByStatus(ApplicationStatus status) const override;
+    bool jobApplicationExists(const std::string& applicationId) const override;
+};
+
+#endif // SQLITEJOBAPPLICATIONREPOSITORY_H
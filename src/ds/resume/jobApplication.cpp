@@ -1,5 +1,6 @@
 #include "jobApplication.h"
 #include <algorithm>
+#include <utility>
 
 JobApplication::JobApplication()
     : applicationId(""), jobId(""), jobTitle(""), company(""),
@@ -41,23 +42,23 @@ std::string JobApplication::getReferralSource() const { return referralSource; }
 std::string JobApplication::getApplicationMethod() const { return applicationMethod; }
 std::string JobApplication::getNotes() const { return notes; }
 
-void JobApplication::setApplicationId(const std::string& applicationId) { this->applicationId = applicationId; }
-void JobApplication::setJobId(const std::string& jobId) { this->jobId = jobId; }
-void JobApplication::setJobTitle(const std::string& jobTitle) { this->jobTitle = jobTitle; }
-void JobApplication::setCompany(const std::string& company) { this->company = company; }
-void JobApplication::setDateApplied(const std::string& dateApplied) { this->dateApplied = dateApplied; }
+void JobApplication::setApplicationId(std::string applicationId) { this->applicationId = std::move(applicationId); }
+void JobApplication::setJobId(std::string jobId) { this->jobId = std::move(jobId); }
+void JobApplication::setJobTitle(std::string jobTitle) { this->jobTitle = std::move(jobTitle); }
+void JobApplication::setCompany(std::string company) { this->company = std::move(company); }
+void JobApplication::setDateApplied(std::string dateApplied) { this->dateApplied = std::move(dateApplied); }
 void JobApplication::setStatus(ApplicationStatus status) { this->status = status; }
-void JobApplication::setContactName(const std::string& contactName) { this->contactName = contactName; }
-void JobApplication::setContactEmail(const std::string& contactEmail) { this->contactEmail = contactEmail; }
-void JobApplication::setContactPhone(const std::string& contactPhone) { this->contactPhone = contactPhone; }
-void JobApplication::setComments(const std::string& comments) { this->comments = comments; }
-void JobApplication::setApplicationUrl(const std::string& applicationUrl) { this->applicationUrl = applicationUrl; }
-void JobApplication::setSalaryOffered(const std::string& salaryOffered) { this->salaryOffered = salaryOffered; }
-void JobApplication::setExpectedSalary(const std::string& expectedSalary) { this->expectedSalary = expectedSalary; }
-void JobApplication::setResponseDeadline(const std::string& responseDeadline) { this->responseDeadline = responseDeadline; }
-void JobApplication::setReferralSource(const std::string& referralSource) { this->referralSource = referralSource; }
-void JobApplication::setApplicationMethod(const std::string& applicationMethod) { this->applicationMethod = applicationMethod; }
-void JobApplication::setNotes(const std::string& notes) { this->notes = notes; }
+void JobApplication::setContactName(std::string contactName) { this->contactName = std::move(contactName); }
+void JobApplication::setContactEmail(std::string contactEmail) { this->contactEmail = std::move(contactEmail); }
+void JobApplication::setContactPhone(std::string contactPhone) { this->contactPhone = std::move(contactPhone); }
+void JobApplication::setComments(std::string comments) { this->comments = std::move(comments); }
+void JobApplication::setApplicationUrl(std::string applicationUrl) { this->applicationUrl = std::move(applicationUrl); }
+void JobApplication::setSalaryOffered(std::string salaryOffered) { this->salaryOffered = std::move(salaryOffered); }
+void JobApplication::setExpectedSalary(std::string expectedSalary) { this->expectedSalary = std::move(expectedSalary); }
+void JobApplication::setResponseDeadline(std::string responseDeadline) { this->responseDeadline = std::move(responseDeadline); }
+void JobApplication::setReferralSource(std::string referralSource) { this->referralSource = std::move(referralSource); }
+void JobApplication::setApplicationMethod(std::string applicationMethod) { this->applicationMethod = std::move(applicationMethod); }
+void JobApplication::setNotes(std::string notes) { this->notes = std::move(notes); }
 
 void JobApplication::addInterviewDate(const std::string& interviewDate) {
     interviewDates.push_back(interviewDate);
@@ -69,23 +69,23 @@ public:
     std::string getApplicationMethod() const;
     std::string getNotes() const;
 
-    void setApplicationId(const std::string& applicationId);
-    void setJobId(const std::string& jobId);
-    void setJobTitle(const std::string& jobTitle);
-    void setCompany(const std::string& company);
-    void setDateApplied(const std::string& dateApplied);
+    void setApplicationId(std::string applicationId);
+    void setJobId(std::string jobId);
+    void setJobTitle(std::string jobTitle);
+    void setCompany(std::string company);
+    void setDateApplied(std::string dateApplied);
     void setStatus(ApplicationStatus status);
-    void setContactName(const std::string& contactName);
-    void setContactEmail(const std::string& contactEmail);
-    void setContactPhone(const std::string& contactPhone);
-    void setComments(const std::string& comments);
-    void setApplicationUrl(const std::string& applicationUrl);
-    void setSalaryOffered(const std::string& salaryOffered);
-    void setExpectedSalary(const std::string& expectedSalary);
-    void setResponseDeadline(const std::string& responseDeadline);
-    void setReferralSource(const std::string& referralSource);
-    void setApplicationMethod(const std::string& applicationMethod);
-    void setNotes(const std::string& notes);
+    void setContactName(std::string contactName);
+    void setContactEmail(std::string contactEmail);
+    void setContactPhone(std::string contactPhone);
+    void setComments(std::string comments);
+    void setApplicationUrl(std::string applicationUrl);
+    void setSalaryOffered(std::string salaryOffered);
+    void setExpectedSalary(std::string expectedSalary);
+    void setResponseDeadline(std::string responseDeadline);
+    void setReferralSource(std::string referralSource);
+    void setApplicationMethod(std::string applicationMethod);
+    void setNotes(std::string notes);
 
     void addInterviewDate(const std::string& interviewDate);
     void addFollowUpDate(const std::string& followUpDate);
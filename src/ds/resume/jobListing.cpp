@@ -1,5 +1,6 @@
 #include "jobListing.h"
 #include <algorithm>
+#include <utility>
 
 // Constructors
 JobListing::JobListing()
@@ -74,11 +75,11 @@ std::string JobListing::getReportingTo() const { return reportingTo; }
 std::vector<std::string> JobListing::getTags() const { return tags; }
 
 // Basic setters
-void JobListing::setJobId(const std::string& jobId) { this->jobId = jobId; }
-void JobListing::setTitle(const std::string& title) { this->title = title; }
-void JobListing::setCompany(const std::string& company) { this->company = company; }
-void JobListing::setDescription(const std::string& description) { this->description = description; }
-void JobListing::setLocation(const std::string& location) { this->location = location; }
+void JobListing::setJobId(std::string jobId) { this->jobId = std::move(jobId); }
+void JobListing::setTitle(std::string title) { this->title = std::move(title); }
+void JobListing::setCompany(std::string company) { this->company = std::move(company); }
+void JobListing::setDescription(std::string description) { this->description = std::move(description); }
+void JobListing::setLocation(std::string location) { this->location = std::move(location); }
 void JobListing::setRemoteType(RemoteType remoteType) { this->remoteType = remoteType; }
 void JobListing::setJobType(JobType jobType) { this->jobType = jobType; }
 void JobListing::setExperienceLevel(JobExperienceLevel experienceLevel) { this->experienceLevel = experienceLevel; }
@@ -92,7 +93,7 @@ void JobListing::setSalaryRange(float min, float max, const std::string& currenc
 
 void JobListing::setSalaryMin(float salaryMin) { this->salaryMin = salaryMin; }
 void JobListing::setSalaryMax(float salaryMax) { this->salaryMax = salaryMax; }
-void JobListing::setSalaryCurrency(const std::string& currency) { this->salaryCurrency = currency; }
+void JobListing::setSalaryCurrency(std::string currency) { this->salaryCurrency = std::move(currency); }
 
 // Required qualifications setters
 void JobListing::setRequiredSkills(const Skills& skills) { this->requiredSkills = skills; }
@@ -131,20 +132,20 @@ void JobListing::addResponsibility(const std::string& responsibility) {
     responsibilities.push_back(responsibility);
 }
 
-void JobListing::setApplicationDeadline(const std::string& deadline) { this->applicationDeadline = deadline; }
-void JobListing::setPostedDate(const std::string& date) { this->postedDate = date; }
-void JobListing::setApplicationUrl(const std::string& url) { this->applicationUrl = url; }
-void JobListing::setContactEmail(const std::string& email) { this->contactEmail = email; }
+void JobListing::setApplicationDeadline(std::string deadline) { this->applicationDeadline = std::move(deadline); }
+void JobListing::setPostedDate(std::string date) { this->postedDate = std::move(date); }
+void JobListing::setApplicationUrl(std::string url) { this->applicationUrl = std::move(url); }
+void JobListing::setContactEmail(std::string email) { this->contactEmail = std::move(email); }
 
 // Company information setters
-void JobListing::setCompanySize(const std::string& size) { this->companySize = size; }
-void JobListing::setIndustry(const std::string& industry) { this->industry = industry; }
-void JobListing::setCompanyWebsite(const std::string& website) { this->companyWebsite = website; }
+void JobListing::setCompanySize(std::string size) { this->companySize = std::move(size); }
+void JobListing::setIndustry(std::string industry) { this->industry = std::move(industry); }
+void JobListing::setCompanyWebsite(std::string website) { this->companyWebsite = std::move(website); }
 
 // Additional metadata setters
 void JobListing::setIsActive(bool active) { this->isActive = active; }
-void JobListing::setDepartment(const std::string& department) { this->department = department; }
-void JobListing::setReportingTo(const std::string& reportingTo) { this->reportingTo = reportingTo; }
+void JobListing::setDepartment(std::string department) { this->department = std::move(department); }
+void JobListing::setReportingTo(std::string reportingTo) { this->reportingTo = std::move(reportingTo); }
 
 void JobListing::addTag(const std::string& tag) {
     tags.push_back(tag);
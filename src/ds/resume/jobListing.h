@@ -133,11 +133,11 @@ public:
     std::vector<std::string> getTags() const;
 
     // Basic setters
-    void setJobId(const std::string& jobId);
-    void setTitle(const std::string& title);
-    void setCompany(const std::string& company);
-    void setDescription(const std::string& description);
-    void setLocation(const std::string& location);
+    void setJobId(std::string jobId);
+    void setTitle(std::string title);
+    void setCompany(std::string company);
+    void setDescription(std::string description);
+    void setLocation(std::string location);
     void setRemoteType(RemoteType remoteType);
     void setJobType(JobType jobType);
     void setExperienceLevel(JobExperienceLevel experienceLevel);
@@ -146,7 +146,7 @@ public:
     void setSalaryRange(float min, float max, const std::string& currency = "USD");
     void setSalaryMin(float salaryMin);
     void setSalaryMax(float salaryMax);
-    void setSalaryCurrency(const std::string& currency);
+    void setSalaryCurrency(std::string currency);
 
     // Required qualifications setters
     void setRequiredSkills(const Skills& skills);
@@ -163,20 +163,20 @@ public:
     // Benefits and details setters
     void addBenefit(const std::string& benefit);
     void addResponsibility(const std::string& responsibility);
-    void setApplicationDeadline(const std::string& deadline);
-    void setPostedDate(const std::string& date);
-    void setApplicationUrl(const std::string& url);
-    void setContactEmail(const std::string& email);
+    void setApplicationDeadline(std::string deadline);
+    void setPostedDate(std::string date);
+    void setApplicationUrl(std::string url);
+    void setContactEmail(std::string email);
 
     // Company information setters
-    void setCompanySize(const std::string& size);
-    void setIndustry(const std::string& industry);
-    void setCompanyWebsite(const std::string& website);
+    void setCompanySize(std::string size);
+    void setIndustry(std::string industry);
+    void setCompanyWebsite(std::string website);
 
     // Additional metadata setters
     void setIsActive(bool active);
-    void setDepartment(const std::string& department);
-    void setReportingTo(const std::string& reportingTo);
+    void setDepartment(std::string department);
+    void setReportingTo(std::string reportingTo);
     void addTag(const std::string& tag);
 
     // Utility methods
@@ -1,4 +1,5 @@
 #include "resume.h"
+#include <utility>
 
 Resume::Resume() : id(0), education("", "", "", "", "") {}
 
@@ -78,32 +79,32 @@ void Resume::setId(int id) {
     this->id = id;
 }
 
-void Resume::setName(const std::string& name) {
-    this->name = name;
+void Resume::setName(std::string name) {
+    this->name = std::move(name);
 }
 
-void Resume::setEmail(const std::string& email) {
-    this->email = email;
+void Resume::setEmail(std::string email) {
+    this->email = std::move(email);
 }
 
-void Resume::setCity(const std::string& city) {
-    this->city = city;
+void Resume::setCity(std::string city) {
+    this->city = std::move(city);
 }
 
-void Resume::setPhone(const std::string& phone) {
-    this->phone = phone;
+void Resume::setPhone(std::string phone) {
+    this->phone = std::move(phone);
 }
 
-void Resume::setLinkedin(const std::string& linkedin) {
-    this->linkedin = linkedin;
+void Resume::setLinkedin(std::string linkedin) {
+    this->linkedin = std::move(linkedin);
 }
 
-void Resume::setWebsite(const std::string& website) {
-    this->website = website;
+void Resume::setWebsite(std::string website) {
+    this->website = std::move(website);
 }
 
-void Resume::setInterests(const std::string& interests) {
-    this->interests = interests;
+void Resume::setInterests(std::string interests) {
+    this->interests = std::move(interests);
 }
 
 void Resume::setSkills(const Skills& skills) {
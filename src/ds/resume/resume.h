@@ -56,13 +56,13 @@ class Resume {
 
         // Setters
         void setId(int id);
-        void setName(const std::string& name);
-        void setEmail(const std::string& email);
-        void setCity(const std::string& city);
-        void setPhone(const std::string& phone);
-        void setLinkedin(const std::string& linkedin);
-        void setWebsite(const std::string& website);
-        void setInterests(const std::string& interests);
+        void setName(std::string name);
+        void setEmail(std::string email);
+        void setCity(std::string city);
+        void setPhone(std::string phone);
+        void setLinkedin(std::string linkedin);
+        void setWebsite(std::string website);
+        void setInterests(std::string interests);
 
         void setSkills(const Skills& skills);
         void setEducation(const Education& education);
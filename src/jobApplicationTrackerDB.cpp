@@ -7,8 +7,11 @@
 #include <sstream>
 #include <algorithm>
 #include <memory>
+#include <cstdlib>
 #include "ds/resume/jobApplication.h"
 #include "db/jobApplicationController.h"
+#include "db/cacheInvalidationListener.h"
+#include "db/sqliteJobApplicationRepository.h"
 
 class JobApplicationTrackerDB {
 private:
@@ -31,10 +34,9 @@ private:
     }
 
     void saveToJsonFile() {
-        std::string jsonData = dbController->exportToJson();
         std::ofstream file(jsonFilename);
         if (file.is_open()) {
-            file << jsonData;
+            dbController->exportToJson(file);
             file.close();
             std::cout << "Data saved to JSON file: " << jsonFilename << std::endl;
         } else {
@@ -43,10 +45,9 @@ private:
     }
 
     void exportToCsvFile() {
-        std::string csvData = dbController->exportToCsv();
         std::ofstream file(csvFilename);
         if (file.is_open()) {
-            file << csvData;
+            dbController->exportToCsv(file);
             file.close();
             std::cout << "Data exported to CSV file: " << csvFilename << std::endl;
         } else {
@@ -56,9 +57,14 @@ private:
 
 public:
     JobApplicationTrackerDB(const std::string& jsonFilename = "job_applications.json",
-                           const std::string& csvFilename = "job_applications.csv")
+                           const std::string& csvFilename = "job_applications.csv",
+                           std::shared_ptr<JobApplicationRepository> repository = nullptr)
         : jsonFilename(jsonFilename), csvFilename(csvFilename) {
-        dbController = std::make_unique<JobApplicationController>();
+        if (repository) {
+            dbController = std::make_unique<JobApplicationController>(repository);
+        } else {
+            dbController = std::make_unique<JobApplicationController>();
+        }
     }
 
     void addApplication() {
@@ -382,16 +388,22 @@ public:
             return;
         }
 
+        auto counts = dbController->getJobApplicationCountsByStatus({
+            ApplicationStatus::APPLIED, ApplicationStatus::REVIEWING, ApplicationStatus::INTERVIEW_SCHEDULED,
+            ApplicationStatus::INTERVIEWING, ApplicationStatus::WAITING_RESPONSE, ApplicationStatus::OFFER_RECEIVED,
+            ApplicationStatus::REJECTED, ApplicationStatus::WITHDRAWN, ApplicationStatus::ACCEPTED
+        });
+
         std::cout << "\nBy Status:\n";
-        std::cout << "Applied: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::APPLIED) << std::endl;
-        std::cout << "Reviewing: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::REVIEWING) << std::endl;
-        std::cout << "Interview Scheduled: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::INTERVIEW_SCHEDULED) << std::endl;
-        std::cout << "Interviewing: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::INTERVIEWING) << std::endl;
-        std::cout << "Waiting Response: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::WAITING_RESPONSE) << std::endl;
-        std::cout << "Offer Received: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::OFFER_RECEIVED) << std::endl;
-        std::cout << "Rejected: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::REJECTED) << std::endl;
-        std::cout << "Withdrawn: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::WITHDRAWN) << std::endl;
-        std::cout << "Accepted: " << dbController->getJobApplicationCountByStatus(ApplicationStatus::ACCEPTED) << std::endl;
+        std::cout << "Applied: " << counts[ApplicationStatus::APPLIED] << std::endl;
+        std::cout << "Reviewing: " << counts[ApplicationStatus::REVIEWING] << std::endl;
+        std::cout << "Interview Scheduled: " << counts[ApplicationStatus::INTERVIEW_SCHEDULED] << std::endl;
+        std::cout << "Interviewing: " << counts[ApplicationStatus::INTERVIEWING] << std::endl;
+        std::cout << "Waiting Response: " << counts[ApplicationStatus::WAITING_RESPONSE] << std::endl;
+        std::cout << "Offer Received: " << counts[ApplicationStatus::OFFER_RECEIVED] << std::endl;
+        std::cout << "Rejected: " << counts[ApplicationStatus::REJECTED] << std::endl;
+        std::cout << "Withdrawn: " << counts[ApplicationStatus::WITHDRAWN] << std::endl;
+        std::cout << "Accepted: " << counts[ApplicationStatus::ACCEPTED] << std::endl;
     }
 
     void exportData() {
@@ -474,12 +486,67 @@ public:
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+    // --query-stats prints per-statement timings on exit;
+    // --slow-query-ms=N logs statements slower than N ms as they run;
+    // --query-cache serves repeated reads from memory (needs the schema's
+    //   notify triggers so other processes' writes invalidate it);
+    // --sqlite=FILE stores applications in FILE instead of PostgreSQL.
+    bool showQueryStats = false;
+    bool useQueryCache = false;
+    std::string sqlitePath;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--query-stats") {
+            showQueryStats = true;
+        } else if (arg.compare(0, 16, "--slow-query-ms=") == 0) {
+            QueryStatistics::getInstance()->setSlowQueryThreshold(
+                std::chrono::milliseconds(std::atoi(arg.c_str() + 16)));
+        } else if (arg == "--query-cache") {
+            useQueryCache = true;
+        } else if (arg.compare(0, 9, "--sqlite=") == 0) {
+            sqlitePath = arg.substr(9);
+        }
+    }
+
+    if (!sqlitePath.empty()) {
+        std::cout << "=== REZZ Job Application Tracker with Database ===\n";
+        auto repository = std::make_shared<SqliteJobApplicationRepository>(sqlitePath);
+        if (!repository->open()) {
+            return 1;
+        }
+        std::cout << "Using SQLite database: " << sqlitePath << "\n";
+
+        JobApplicationTrackerDB tracker("job_applications_db.json", "job_applications_db.csv", repository);
+        tracker.showMenu();
+        return 0;
+    }
+
     std::cout << "=== REZZ Job Application Tracker with Database ===\n";
     std::cout << "Connecting to PostgreSQL database...\n";
 
-    auto db = DatabaseConnection::getInstance();
-    if (!db->connect()) {
+    // The menu re-lists the same applications after every action; serve
+    // those reads from memory until something writes the tables they read.
+    // Other tracker instances announce their writes through the schema's
+    // notify triggers, so the cache is only installed once the listener for
+    // them is running. It has to be in place before the pool connects.
+    auto pool = ConnectionPool::getInstance();
+    std::unique_ptr<CacheInvalidationListener> cacheListener;
+    if (useQueryCache) {
+        const ConnectionPoolConfig& config = pool->getConfig();
+        std::shared_ptr<QueryCache> cache = std::make_shared<QueryCache>();
+        cacheListener.reset(new CacheInvalidationListener(
+            std::make_shared<DatabaseConnection>(config.host, config.port, config.dbname, config.user, config.password),
+            cache));
+        if (cacheListener->start()) {
+            QueryCache::setInstance(cache);
+        } else {
+            std::cerr << "Cache invalidation listener unavailable; query cache disabled\n";
+            cacheListener.reset();
+        }
+    }
+
+    if (!pool->initialize()) {
         std::cerr << "Failed to connect to database. Please ensure PostgreSQL is running and the database is set up.\n";
         std::cerr << "Using default connection: host=localhost port=5432 dbname=rezz_db user=postgres\n";
         return 1;
@@ -490,5 +557,14 @@ int main() {
     JobApplicationTrackerDB tracker("job_applications_db.json", "job_applications_db.csv");
     tracker.showMenu();
 
+    if (showQueryStats) {
+        QueryStatistics::getInstance()->dump(std::cout);
+        if (std::shared_ptr<QueryCache> cache = QueryCache::getInstance()) {
+            QueryCacheStats stats = cache->getStats();
+            std::cout << "Result cache: " << stats.hits << " hits, " << stats.misses << " misses, "
+                      << stats.invalidations << " invalidated, " << stats.evictions << " evicted\n";
+        }
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <sstream>
 #include <iomanip>
 #include <memory>
+#include <chrono>
+#include <cstdlib>
 #include "ds/resume/resume.h"
 #include "db/resumeController.h"
 
@@ -447,12 +449,25 @@ public:
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+    // --query-stats prints per-statement timings on exit;
+    // --slow-query-ms=N logs statements slower than N ms as they run.
+    bool showQueryStats = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--query-stats") {
+            showQueryStats = true;
+        } else if (arg.compare(0, 16, "--slow-query-ms=") == 0) {
+            QueryStatistics::getInstance()->setSlowQueryThreshold(
+                std::chrono::milliseconds(std::atoi(arg.c_str() + 16)));
+        }
+    }
+
     std::cout << "=== REZZ Resume Builder with Database ===\n";
     std::cout << "Connecting to PostgreSQL database...\n";
 
-    auto db = DatabaseConnection::getInstance();
-    if (!db->connect()) {
+    auto pool = ConnectionPool::getInstance();
+    if (!pool->initialize()) {
         std::cerr << "Failed to connect to database. Please ensure PostgreSQL is running and the database is set up.\n";
         std::cerr << "Using default connection: host=localhost port=5432 dbname=rezz_db user=postgres\n";
         return 1;
@@ -463,5 +478,9 @@ int main() {
     ResumeBuilderDB builder("resumes_db.json");
     builder.showMenu();
 
+    if (showQueryStats) {
+        QueryStatistics::getInstance()->dump(std::cout);
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,339 @@
+#include <iostream>
+#include <sstream>
+#include <cassert>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "../../src/db/connectionPool.h"
+#include "../../src/db/connectionRouter.h"
+
+class ConnectionPoolTest {
+private:
+    ConnectionPoolConfig config;
+
+    std::shared_ptr<ConnectionPool> makePool(size_t minSize, size_t maxSize, int acquireTimeoutMs) {
+        ConnectionPoolConfig poolConfig = config;
+        poolConfig.minSize = minSize;
+        poolConfig.maxSize = maxSize;
+        poolConfig.acquireTimeout = std::chrono::milliseconds(acquireTimeoutMs);
+        return std::make_shared<ConnectionPool>(poolConfig);
+    }
+
+public:
+    ConnectionPoolTest() {
+        config.dbname = "rezz_test_db";
+        auto probe = std::make_shared<ConnectionPool>(config);
+        if (!probe->initialize()) {
+            std::cout << "Warning: Could not connect to test database. Trying default connection..." << std::endl;
+            config = ConnectionPoolConfig();
+        }
+    }
+
+    void testInitialize() {
+        std::cout << "Testing pool initialization..." << std::endl;
+
+        auto pool = makePool(2, 4, 1000);
+        assert(pool->initialize());
+        assert(pool->size() == 2);
+        assert(pool->idleCount() == 2);
+        assert(pool->inUseCount() == 0);
+
+        std::cout << "✓ Pool initialization tests passed" << std::endl;
+    }
+
+    void testAcquireAndRelease() {
+        std::cout << "Testing connection checkout and return..." << std::endl;
+
+        auto pool = makePool(1, 2, 1000);
+        assert(pool->initialize());
+
+        {
+            PooledConnection connection = pool->acquire();
+            assert(connection);
+            assert(connection->isConnected());
+            assert(pool->inUseCount() == 1);
+            assert(pool->idleCount() == 0);
+
+            PGresult* result = connection->executeQuery("SELECT 1 as test_value");
+            assert(result != nullptr);
+            DatabaseResult dbResult(result);
+            assert(dbResult.next());
+            assert(dbResult.getInt("test_value") == 1);
+        }
+
+        assert(pool->inUseCount() == 0);
+        assert(pool->idleCount() == 1);
+
+        PooledConnection first = pool->acquire();
+        PooledConnection moved = std::move(first);
+        assert(!first);
+        assert(moved);
+        assert(pool->inUseCount() == 1);
+        moved.release();
+        assert(pool->inUseCount() == 0);
+
+        std::cout << "✓ Checkout and return tests passed" << std::endl;
+    }
+
+    void testFailFastWhenExhausted() {
+        std::cout << "Testing fail-fast on exhausted pool..." << std::endl;
+
+        auto pool = makePool(0, 2, 0);
+        PooledConnection a = pool->acquire();
+        PooledConnection b = pool->acquire();
+        assert(a && b);
+        assert(pool->size() == 2);
+
+        PooledConnection c = pool->tryAcquire();
+        assert(!c);
+
+        PooledConnection d = pool->acquire(std::chrono::milliseconds(50));
+        assert(!d);
+
+        a.release();
+        PooledConnection e = pool->tryAcquire();
+        assert(e);
+
+        std::cout << "✓ Fail-fast tests passed" << std::endl;
+    }
+
+    void testBlockingAcquire() {
+        std::cout << "Testing blocking checkout..." << std::endl;
+
+        auto pool = makePool(1, 1, 5000);
+        PooledConnection held = pool->acquire();
+        assert(held);
+
+        std::thread releaser([&held]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            held.release();
+        });
+
+        auto start = std::chrono::steady_clock::now();
+        PooledConnection waited = pool->acquire();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        releaser.join();
+
+        assert(waited);
+        assert(elapsed >= std::chrono::milliseconds(50));
+
+        std::cout << "✓ Blocking checkout tests passed" << std::endl;
+    }
+
+    void testParallelQueries() {
+        std::cout << "Testing parallel queries across pooled connections..." << std::endl;
+
+        const int threadCount = 4;
+        auto pool = makePool(threadCount, threadCount, 5000);
+        assert(pool->initialize());
+
+        std::atomic<int> succeeded(0);
+        std::vector<std::thread> threads;
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < threadCount; i++) {
+            threads.emplace_back([&pool, &succeeded]() {
+                PooledConnection connection = pool->acquire();
+                if (connection && connection->executeNonQuery("SELECT pg_sleep(0.2)")) {
+                    succeeded++;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        assert(succeeded == threadCount);
+        assert(elapsed < std::chrono::milliseconds(200 * threadCount));
+        assert(pool->inUseCount() == 0);
+
+        std::cout << "✓ Parallel query tests passed" << std::endl;
+    }
+
+    void testOpenTransactionRolledBack() {
+        std::cout << "Testing rollback of transactions left open on return..." << std::endl;
+
+        auto pool = makePool(1, 1, 1000);
+        std::shared_ptr<DatabaseConnection> raw;
+        {
+            PooledConnection connection = pool->acquire();
+            assert(connection->beginTransaction());
+            assert(connection->inTransaction());
+            raw = connection.get();
+        }
+
+        PooledConnection again = pool->acquire();
+        assert(again.get() == raw);
+        assert(!again->inTransaction());
+
+        std::cout << "✓ Transaction rollback tests passed" << std::endl;
+    }
+
+    void testHealthCheck() {
+        std::cout << "Testing idle connection health check..." << std::endl;
+
+        auto pool = makePool(2, 4, 1000);
+        assert(pool->initialize());
+
+        {
+            PooledConnection connection = pool->acquire();
+            connection->disconnect();
+        }
+        assert(pool->size() == 1);
+
+        pool->healthCheck();
+        assert(pool->size() == 2);
+        assert(pool->idleCount() == 2);
+
+        std::cout << "✓ Health check tests passed" << std::endl;
+    }
+
+    void testReadRouting() {
+        std::cout << "Testing read routing across replicas..." << std::endl;
+
+        // Two extra pools on the same database stand in for replicas.
+        auto primary = makePool(1, 2, 1000);
+        auto replicaA = makePool(0, 2, 1000);
+        auto replicaB = makePool(0, 2, 1000);
+
+        ConnectionRouter router(primary);
+        router.addReplica(replicaA);
+        router.addReplica(replicaB);
+        assert(router.initialize());
+        assert(router.getReplicaCount() == 2);
+
+        {
+            PooledConnection first = router.acquireRead();
+            PooledConnection second = router.acquireRead();
+            assert(first && second);
+            assert(replicaA->inUseCount() == 1);
+            assert(replicaB->inUseCount() == 1);
+            assert(primary->inUseCount() == 0);
+
+            PooledConnection write = router.acquireWrite();
+            assert(write);
+            assert(primary->inUseCount() == 1);
+        }
+
+        ConnectionRouterConfig routerConfig;
+        routerConfig.strategy = ReadStrategy::LEAST_LOADED;
+        ConnectionRouter leastLoaded(primary, routerConfig);
+        leastLoaded.addReplica(replicaA);
+        leastLoaded.addReplica(replicaB);
+        {
+            PooledConnection busy = replicaA->acquire();
+            PooledConnection read = leastLoaded.acquireRead();
+            PooledConnection another = leastLoaded.acquireRead();
+            assert(read && another);
+            assert(replicaA->inUseCount() == 1);
+            assert(replicaB->inUseCount() == 2);
+        }
+
+        std::cout << "✓ Read routing tests passed" << std::endl;
+    }
+
+    void testReplicaFallback() {
+        std::cout << "Testing fallback when replicas are unavailable..." << std::endl;
+
+        auto primary = makePool(1, 2, 1000);
+        ConnectionRouterConfig routerConfig;
+        ConnectionPoolConfig deadReplica = config;
+        deadReplica.port = 1;
+        deadReplica.minSize = 0;
+        routerConfig.replicas.push_back(deadReplica);
+        routerConfig.replicaBackoff.initialBackoff = std::chrono::milliseconds(60000);
+
+        ConnectionRouter router(primary, routerConfig);
+        assert(router.initialize());
+        assert(router.hasReplicas());
+        assert(router.getHealthyReplicaCount() == 1);
+
+        PooledConnection read = router.acquireRead();
+        assert(read);
+        assert(primary->inUseCount() == 1);
+
+        PGresult* result = read->executeQuery("SELECT 1 as test_value");
+        assert(result != nullptr);
+        PQclear(result);
+
+        // The failed connect benches the replica; the next read goes
+        // straight to the primary without trying it again.
+        assert(router.getHealthyReplicaCount() == 0);
+        assert(router.getReplicaCount() == 1);
+        PooledConnection again = router.acquireRead();
+        assert(again);
+        assert(primary->inUseCount() == 2);
+        again.release();
+
+        ConnectionRouter noReplicas(primary);
+        PooledConnection fromPrimary = noReplicas.acquireRead();
+        assert(fromPrimary);
+        assert(primary->inUseCount() == 2);
+
+        std::cout << "✓ Replica fallback tests passed" << std::endl;
+    }
+
+    void testLastWriteTime() {
+        std::cout << "Testing write tracking for read-your-writes..." << std::endl;
+
+        auto pool = makePool(1, 1, 1000);
+        PooledConnection connection = pool->acquire();
+        assert(connection);
+
+        std::chrono::steady_clock::time_point before = connection->getLastWriteTime();
+        PGresult* result = connection->executeQuery("SELECT 1");
+        assert(result != nullptr);
+        PQclear(result);
+        assert(connection->getLastWriteTime() == before);
+
+        // An export reads; it must not pin later reads to the primary.
+        std::ostringstream csv;
+        assert(connection->copyOut("COPY (SELECT 1 AS one) TO STDOUT WITH (FORMAT csv)", csv));
+        assert(connection->getLastWriteTime() == before);
+
+        assert(connection->executeNonQuery("CREATE TEMP TABLE router_write_test (id INT)"));
+        assert(connection->getLastWriteTime() > before);
+
+        std::chrono::steady_clock::time_point afterCreate = connection->getLastWriteTime();
+        assert(connection->copyOut("COPY router_write_test TO STDOUT", csv));
+        assert(connection->getLastWriteTime() == afterCreate);
+
+        std::cout << "✓ Write tracking tests passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "=== Connection Pool Tests ===" << std::endl;
+
+        try {
+            testInitialize();
+            testAcquireAndRelease();
+            testFailFastWhenExhausted();
+            testBlockingAcquire();
+            testParallelQueries();
+            testOpenTransactionRolledBack();
+            testHealthCheck();
+            testReadRouting();
+            testReplicaFallback();
+            testLastWriteTime();
+
+            std::cout << "\n✓ All connection pool tests passed successfully!" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "Test failed with exception: " << e.what() << std::endl;
+            exit(1);
+        }
+    }
+};
+
+int main() {
+    std::cout << "Starting connection pool tests..." << std::endl;
+    std::cout << "Note: This test requires a PostgreSQL database to be running." << std::endl;
+    std::cout << "Expected connection: host=localhost port=5432 dbname=rezz_test_db user=postgres" << std::endl;
+
+    ConnectionPoolTest test;
+    test.runAllTests();
+
+    return 0;
+}
@@ -2,7 +2,12 @@
 #include <cassert>
 #include <memory>
 #include <vector>
+#include <sstream>
+#include <cstdio>
+#include <chrono>
+#include <thread>
 #include "../../src/db/database.h"
+#include "../../src/db/cacheInvalidationListener.h"
 
 class DatabaseTest {
 private:
@@ -286,6 +291,733 @@ public:
         std::cout << "✓ String escaping tests passed" << std::endl;
     }
 
+    void testPreparedStatementCache() {
+        std::cout << "Testing prepared statement cache..." << std::endl;
+
+        db->clearStatementCache();
+        size_t originalCapacity = db->getStatementCacheCapacity();
+
+        std::string selectQuery = "SELECT age FROM test_table WHERE name = $1";
+        for (int i = 0; i < 3; i++) {
+            std::vector<std::string> params = {"John Doe"};
+            PGresult* result = db->executeParameterizedQuery(selectQuery, params);
+            assert(result != nullptr);
+            DatabaseResult dbResult(result);
+            assert(dbResult.next());
+            assert(dbResult.getInt("age") == 31);
+        }
+        assert(db->getPreparedStatementCount() == 1);
+
+        std::vector<std::string> countParams = {"true"};
+        PGresult* countResult = db->executeParameterizedQuery(
+            "SELECT COUNT(*) FROM test_table WHERE active = $1", countParams);
+        assert(countResult != nullptr);
+        PQclear(countResult);
+        assert(db->getPreparedStatementCount() == 2);
+
+        db->setStatementCacheCapacity(1);
+        assert(db->getPreparedStatementCount() == 1);
+
+        assert(db->connect());
+        assert(db->getPreparedStatementCount() == 1);
+        std::vector<std::string> params = {"John Doe"};
+        PGresult* afterReconnect = db->executeParameterizedQuery(selectQuery, params);
+        assert(afterReconnect != nullptr);
+        PQclear(afterReconnect);
+
+        db->setStatementCacheCapacity(0);
+        assert(db->getPreparedStatementCount() == 0);
+        PGresult* uncached = db->executeParameterizedQuery(selectQuery, params);
+        assert(uncached != nullptr);
+        PQclear(uncached);
+
+        db->setStatementCacheCapacity(originalCapacity);
+
+        std::cout << "✓ Prepared statement cache tests passed" << std::endl;
+    }
+
+    void testTypedExecute() {
+        std::cout << "Testing typed parameter binding..." << std::endl;
+
+        // Binary encoding is checked directly so it doesn't depend on the server.
+        BoundParams<4> params;
+        params.bind(-2);
+        params.bind(5000000000LL);
+        params.bind(true);
+        params.bind(std::optional<int>());
+        assert(params.count == 4);
+        assert(params.types[0] == 23 && params.lengths[0] == 4 && params.formats[0] == 1);
+        assert(static_cast<unsigned char>(params.values[0][0]) == 0xFF);
+        assert(static_cast<unsigned char>(params.values[0][3]) == 0xFE);
+        assert(params.types[1] == 20 && params.lengths[1] == 8);
+        assert(params.types[2] == 16 && params.values[2][0] == 1);
+        assert(params.values[3] == nullptr);
+
+        // A view is borrowed in place with its length; no terminator needed.
+        std::string padded = "John Doe, Esq.";
+        std::string_view name(padded.data(), 8);
+        BoundParams<1> viewParams;
+        viewParams.bind(name);
+        assert(viewParams.values[0] == padded.data());
+        assert(viewParams.lengths[0] == 8);
+        assert(viewParams.formats[0] == 1 && viewParams.types[0] == 25);
+
+        db->clearStatementCache();
+        PGresult* result = db->execute("SELECT age FROM test_table WHERE name = $1 AND active = $2",
+                                       std::string("John Doe"), true);
+        assert(result != nullptr);
+        DatabaseResult dbResult(result);
+        assert(dbResult.next());
+        assert(dbResult.getInt("age") == 31);
+
+        result = db->execute("SELECT age FROM test_table WHERE name = $1", name);
+        assert(result != nullptr);
+        DatabaseResult viewResult(result);
+        assert(viewResult.next());
+        assert(viewResult.getInt("age") == 31);
+
+        // Same SQL with different argument types gets its own statement.
+        result = db->execute("SELECT $1::text", 42);
+        assert(result != nullptr);
+        PQclear(result);
+        result = db->execute("SELECT $1::text", 4.5);
+        assert(result != nullptr);
+        DatabaseResult doubleResult(result);
+        assert(doubleResult.next());
+        assert(doubleResult.getString(0) == "4.5");
+        assert(db->getPreparedStatementCount() == 4);
+
+        assert(db->executeNonQuery("UPDATE test_table SET age = $2 WHERE name = $1", "John Doe", 32));
+        result = db->execute("SELECT COUNT(*) FROM test_table WHERE age = $1 OR age = $2",
+                             32LL, std::optional<long long>());
+        assert(result != nullptr);
+        DatabaseResult countResult(result);
+        assert(countResult.next());
+        assert(countResult.getInt(0) == 1);
+        assert(db->executeNonQuery("UPDATE test_table SET age = $2 WHERE name = $1", "John Doe", 31));
+
+        std::cout << "✓ Typed parameter binding tests passed" << std::endl;
+    }
+
+    void testBatch() {
+        std::cout << "Testing pipelined statement batches..." << std::endl;
+
+        std::string insertQuery = "INSERT INTO test_table (name, age) VALUES ($1, $2)";
+
+        DatabaseConnection::Batch batch(*db);
+        batch.add(insertQuery, {"Batch One", "21"});
+        batch.add(insertQuery, {"Batch Two", "22"});
+        size_t countIndex = batch.add("SELECT COUNT(*) as total FROM test_table WHERE name LIKE $1", {"Batch %"});
+        assert(batch.size() == 3);
+        assert(batch.execute());
+
+        assert(batch.succeeded(0));
+        assert(batch.succeeded(1));
+        DatabaseResult countResult(batch.takeResult(countIndex));
+        assert(countResult.next());
+        assert(countResult.getInt("total") == 2);
+
+        DatabaseConnection::Batch failing(*db);
+        failing.add(insertQuery, {"Batch Three", "23"});
+        failing.add("INSERT INTO nonexistent_table (name) VALUES ($1)", {"x"});
+        failing.add(insertQuery, {"Batch Four", "24"});
+        assert(!failing.execute());
+        assert(failing.succeeded(0));
+        assert(!failing.succeeded(1));
+        assert(!failing.succeeded(2));
+        assert(!failing.getError(1).empty());
+
+        PGresult* result = db->executeQuery("SELECT COUNT(*) as total FROM test_table WHERE name LIKE 'Batch %'");
+        assert(result != nullptr);
+        DatabaseResult afterFailure(result);
+        assert(afterFailure.next());
+        assert(afterFailure.getInt("total") == 2);
+
+        assert(db->executeNonQuery("DELETE FROM test_table WHERE name LIKE 'Batch %'"));
+
+        // More distinct statements than the cache holds: none may be
+        // deallocated before the pipeline sends it.
+        size_t originalCapacity = db->getStatementCacheCapacity();
+        db->setStatementCacheCapacity(1);
+        DatabaseConnection::Batch overflow(*db);
+        overflow.add(insertQuery, {"Batch Five", "25"});
+        overflow.add("UPDATE test_table SET age = $2 WHERE name = $1", {"Batch Five", "26"});
+        size_t ageIndex = overflow.add("SELECT age FROM test_table WHERE name = $1", {"Batch Five"});
+        assert(overflow.execute());
+        DatabaseResult ageResult(overflow.takeResult(ageIndex));
+        assert(ageResult.next());
+        assert(ageResult.getInt("age") == 26);
+        assert(db->getPreparedStatementCount() <= 1);
+        db->setStatementCacheCapacity(originalCapacity);
+
+        assert(db->executeNonQuery("DELETE FROM test_table WHERE name LIKE 'Batch %'"));
+
+        std::cout << "✓ Batch tests passed" << std::endl;
+    }
+
+    void testAsyncQueries() {
+        std::cout << "Testing asynchronous query execution..." << std::endl;
+
+        std::future<DatabaseResult> first = db->executeAsync("SELECT $1::int as value", {"1"});
+        std::future<DatabaseResult> second = db->executeAsync("SELECT $1::int as value", {"2"});
+        std::future<DatabaseResult> failing = db->executeAsync("SELECT * FROM nonexistent_table");
+
+        int callbackValue = 0;
+        assert(db->executeAsync("SELECT $1::int as value", {"3"}, [&callbackValue](PGresult* result) {
+            DatabaseResult dbResult(result);
+            if (dbResult.next()) {
+                callbackValue = dbResult.getInt("value");
+            }
+        }));
+        assert(db->getPendingAsyncCount() == 4);
+
+        assert(db->waitForAsync());
+        assert(db->getPendingAsyncCount() == 0);
+
+        DatabaseResult firstResult = first.get();
+        assert(firstResult.next());
+        assert(firstResult.getInt("value") == 1);
+
+        DatabaseResult secondResult = second.get();
+        assert(secondResult.next());
+        assert(secondResult.getInt("value") == 2);
+
+        assert(!failing.get().isValid());
+        assert(callbackValue == 3);
+
+        std::future<DatabaseResult> drained = db->executeAsync("SELECT 4 as value");
+        PGresult* syncResult = db->executeQuery("SELECT 5 as value");
+        assert(syncResult != nullptr);
+        PQclear(syncResult);
+        DatabaseResult drainedResult = drained.get();
+        assert(drainedResult.next());
+        assert(drainedResult.getInt("value") == 4);
+
+        // A future dropped unread still frees its result once it arrives.
+        {
+            std::future<DatabaseResult> unread = db->executeAsync("SELECT generate_series(1, 1000) as value");
+            assert(unread.valid());
+        }
+        assert(db->getPendingAsyncCount() == 1);
+        assert(db->waitForAsync());
+        assert(db->getPendingAsyncCount() == 0);
+
+        std::cout << "✓ Async query tests passed" << std::endl;
+    }
+
+    void testForEachRow() {
+        std::cout << "Testing streaming row visitor..." << std::endl;
+
+        int rows = 0;
+        int total = 0;
+        bool success = db->forEachRow("SELECT generate_series(1, $1::int) as n", {"100"},
+                                      [&rows, &total](DatabaseResult& row) {
+            rows++;
+            total += row.getInt("n");
+            return true;
+        });
+        assert(success);
+        assert(rows == 100);
+        assert(total == 5050);
+
+        rows = 0;
+        success = db->forEachRow("SELECT generate_series(1, 100) as n", [&rows](DatabaseResult& row) {
+            rows++;
+            return row.getInt("n") < 10;
+        });
+        assert(success);
+        assert(rows == 10);
+
+        // Stopping cancels the query rather than waiting out ~20s of rows.
+        rows = 0;
+        auto started = std::chrono::steady_clock::now();
+        success = db->forEachRow("SELECT n, pg_sleep(0.01) FROM generate_series(1, 2000) n",
+                                 [&rows](DatabaseResult&) {
+            rows++;
+            return false;
+        });
+        assert(success);
+        assert(rows == 1);
+        assert(std::chrono::steady_clock::now() - started < std::chrono::seconds(5));
+
+        // Inside a transaction the rest is drained so the transaction survives.
+        assert(db->beginTransaction());
+        rows = 0;
+        success = db->forEachRow("SELECT generate_series(1, 100) as n", [&rows](DatabaseResult&) {
+            rows++;
+            return false;
+        });
+        assert(success);
+        assert(rows == 1);
+        PGresult* inTransaction = db->executeQuery("SELECT 1 as still_in_transaction");
+        assert(inTransaction != nullptr);
+        PQclear(inTransaction);
+        assert(db->commitTransaction());
+
+        success = db->forEachRow("SELECT * FROM nonexistent_table", [](DatabaseResult&) { return true; });
+        assert(!success);
+
+        PGresult* result = db->executeQuery("SELECT 1 as still_usable");
+        assert(result != nullptr);
+        PQclear(result);
+
+        std::cout << "✓ Streaming row visitor tests passed" << std::endl;
+    }
+
+    void testBinaryResults() {
+        std::cout << "Testing binary result decoding..." << std::endl;
+
+        std::string query = R"(
+            SELECT $1::int4 as int_value, $2::int8 as big_value, $3::float8 as float_value,
+                   $4::numeric(10,2) as numeric_value, $5::boolean as bool_value,
+                   $6::date as date_value, $7::timestamp as timestamp_value, $8::text as text_value,
+                   NULL::int4 as null_value
+        )";
+        std::vector<std::string> params = {"-42", "1234567890123", "3.25", "120000.50", "true",
+                                           "2024-01-15", "2024-01-15 10:30:00.5", "hello"};
+
+        db->setBinaryResults(true);
+        PGresult* result = db->executeParameterizedQuery(query, params);
+        db->setBinaryResults(false);
+        assert(result != nullptr);
+        assert(PQfformat(result, 0) == 1);
+
+        DatabaseResult dbResult(result);
+        assert(dbResult.next());
+        assert(dbResult.getInt("int_value") == -42);
+        assert(dbResult.getString("int_value") == "-42");
+        assert(dbResult.getInt64("big_value") == 1234567890123LL);
+        assert(dbResult.getDouble("float_value") == 3.25);
+        assert(dbResult.getDouble("numeric_value") == 120000.5);
+        assert(dbResult.getString("numeric_value") == "120000.50");
+        assert(dbResult.getBool("bool_value"));
+        assert(dbResult.getString("bool_value") == "t");
+        assert(dbResult.getString("date_value") == "2024-01-15");
+        assert(dbResult.getString("timestamp_value") == "2024-01-15 10:30:00.5");
+        assert(dbResult.getString("text_value") == "hello");
+        assert(dbResult.isNull("null_value"));
+        assert(dbResult.getInt("null_value") == 0);
+
+        auto row = dbResult.getCurrentRow();
+        assert(row["date_value"] == "2024-01-15");
+
+        std::cout << "✓ Binary result decoding tests passed" << std::endl;
+    }
+
+    void testStringViewAccessors() {
+        std::cout << "Testing string_view accessors and column lookup..." << std::endl;
+
+        PGresult* result = db->executeQuery("SELECT 'abc'::text as name, 7 as num, NULL::text as missing, 1 as name");
+        assert(result != nullptr);
+
+        DatabaseResult dbResult(result);
+        assert(dbResult.next());
+        std::string_view name = dbResult.getStringView("name");
+        assert(name == "abc");
+        assert(name.data() == PQgetvalue(result, 0, 0));
+        assert(dbResult.getStringView(1) == "7");
+        assert(dbResult.getStringView("missing").empty());
+        assert(dbResult.getStringView("nonexistent").empty());
+        assert(dbResult.getFieldIndex("name") == 0);
+        assert(dbResult.getColumns()->indexOf("num") == 1);
+
+        db->setBinaryResults(true);
+        result = db->executeQuery("SELECT 42::int4 as answer, 'xyz'::text as label");
+        db->setBinaryResults(false);
+        assert(result != nullptr);
+
+        DatabaseResult binaryResult(result);
+        assert(binaryResult.next());
+        assert(binaryResult.getStringView("answer") == "42");
+        assert(binaryResult.getStringView("label") == "xyz");
+
+        std::vector<std::string> names;
+        assert(db->forEachRow("SELECT name FROM test_table ORDER BY id", [&names](DatabaseResult& row) {
+            names.emplace_back(row.getStringView("name"));
+            return true;
+        }));
+        assert(names.size() == 3);
+        assert(names[0] == "John Doe");
+
+        std::cout << "✓ string_view accessor tests passed" << std::endl;
+    }
+
+    void testRowSet() {
+        std::cout << "Testing flat row store..." << std::endl;
+
+        RowSet rows;
+        {
+            PGresult* result = db->executeQuery(
+                "SELECT id, name, NULL::text as missing FROM test_table ORDER BY id");
+            assert(result != nullptr);
+            DatabaseResult dbResult(result);
+            rows = dbResult.getAllRows();
+            assert(dbResult.next());
+            assert(dbResult.getCurrentRow()["name"] == rows[0]["name"]);
+        }
+
+        // Without getAllRows() only the current row is copied.
+        RowSet::Row second;
+        {
+            PGresult* result = db->executeQuery("SELECT id, name FROM test_table ORDER BY id");
+            assert(result != nullptr);
+            DatabaseResult dbResult(result);
+            assert(dbResult.next() && dbResult.next());
+            second = dbResult.getCurrentRow();
+            assert(second.size() == 2);
+        }
+        assert(second["name"] == rows[1]["name"]);
+        assert(second.isNull("missing"));
+
+        // The store outlives the DatabaseResult it was built from.
+        assert(rows.size() == 3);
+        assert(rows.getFieldCount() == 3);
+        assert(rows.getFieldName(1) == "name");
+        assert(rows.getFieldIndex("missing") == 2);
+        assert(rows[0]["name"] == "John Doe");
+        assert(rows[0].isNull("missing"));
+        assert(rows[0]["missing"].empty());
+        assert(!rows[0].isNull(0));
+        assert(rows[3]["name"].empty());
+        assert(rows[0]["nonexistent"].empty());
+
+        RowSet::Column names = rows.column("name");
+        assert(names.getName() == "name");
+        assert(names.size() == 3);
+        assert(names[0] == rows[0][1]);
+        assert(names[5].empty());
+        assert(rows.column("nonexistent").size() == 0);
+
+        std::cout << "✓ Flat row store tests passed" << std::endl;
+    }
+
+    void testTypedColumns() {
+        std::cout << "Testing columnar typed views..." << std::endl;
+
+        std::string query = R"(
+            SELECT g as id, CASE WHEN g % 4 = 0 THEN NULL ELSE g * 1.5 END as salary, 'row' || g as label
+            FROM generate_series(1, 100) g ORDER BY g
+        )";
+
+        for (int binary = 0; binary <= 1; binary++) {
+            db->setBinaryResults(binary == 1);
+            PGresult* result = db->executeQuery(query);
+            db->setBinaryResults(false);
+            assert(result != nullptr);
+
+            DatabaseResult dbResult(result);
+            TypedColumn<long long> ids = dbResult.column<long long>("id");
+            TypedColumn<double> salaries = dbResult.column<double>("salary");
+            TypedColumn<std::string> labels = dbResult.column<std::string>(2);
+
+            assert(ids.size() == 100);
+            assert(ids.getNullCount() == 0);
+            assert(ids[99] == 100);
+
+            double total = 0.0;
+            for (double salary : salaries.values()) {
+                total += salary;
+            }
+            assert(salaries.getNullCount() == 25);
+            assert(!salaries.isValid(3));
+            assert(salaries.isValid(4));
+            assert(salaries[3] == 0.0);
+            assert(total == 1.5 * (5050 - 4 * 325));
+
+            assert(labels.getName() == "label");
+            assert(labels[0] == "row1");
+            assert(dbResult.column<int>("nonexistent").empty());
+        }
+
+        std::cout << "✓ Columnar view tests passed" << std::endl;
+    }
+
+    void testCopyWriter() {
+        std::cout << "Testing COPY bulk loading..." << std::endl;
+
+        std::vector<std::string> columns = {"name", "age", "active"};
+
+        DatabaseConnection::CopyWriter text(*db, DatabaseConnection::CopyWriter::TEXT, 256);
+        assert(text.begin("test_table", columns));
+        for (int i = 0; i < 1000; i++) {
+            text.addField("Copy Text " + std::to_string(i));
+            text.addInt(i);
+            text.addBool(i % 2 == 0);
+            assert(text.endRow());
+        }
+        text.addField("Copy Text tab\tnewline\nbackslash\\");
+        text.addNull();
+        text.addBool(true);
+        assert(text.endRow());
+        assert(text.finish());
+        assert(text.getRowCount() == 1001);
+
+        PGresult* result = db->executeQuery("SELECT age, active FROM test_table WHERE name = 'Copy Text 7'");
+        assert(result != nullptr);
+        DatabaseResult textRow(result);
+        assert(textRow.next());
+        assert(textRow.getInt("age") == 7);
+        assert(!textRow.getBool("active"));
+
+        result = db->executeParameterizedQuery("SELECT age FROM test_table WHERE name = $1",
+                                               {"Copy Text tab\tnewline\nbackslash\\"});
+        assert(result != nullptr);
+        DatabaseResult escapedRow(result);
+        assert(escapedRow.next());
+        assert(escapedRow.isNull("age"));
+
+        DatabaseConnection::CopyWriter binary(*db, DatabaseConnection::CopyWriter::BINARY);
+        assert(binary.begin("test_table", columns));
+        for (int i = 0; i < 500; i++) {
+            binary.addField("Copy Binary " + std::to_string(i));
+            binary.addInt(-i);
+            binary.addBool(true);
+            assert(binary.endRow());
+        }
+        assert(binary.finish());
+        assert(binary.getRowCount() == 500);
+
+        result = db->executeQuery("SELECT COUNT(*) as total, MIN(age) as min_age FROM test_table WHERE name LIKE 'Copy Binary %'");
+        assert(result != nullptr);
+        DatabaseResult binaryRows(result);
+        assert(binaryRows.next());
+        assert(binaryRows.getInt("total") == 500);
+        assert(binaryRows.getInt("min_age") == -499);
+
+        // A malformed row aborts the whole load.
+        DatabaseConnection::CopyWriter failing(*db);
+        assert(failing.begin("test_table", columns));
+        assert(failing.writeRow({"Copy Failing 1", "1", "t"}));
+        assert(!failing.writeRow({"Copy Failing 2", "2"}));
+        assert(!failing.finish());
+        assert(!failing.getError().empty());
+
+        DatabaseConnection::CopyWriter badValue(*db);
+        assert(badValue.begin("test_table", columns));
+        assert(badValue.writeRow({"Copy Failing 3", "not a number", "t"}));
+        assert(!badValue.finish());
+        assert(!badValue.getError().empty());
+
+        // Names are quoted, so SQL in a column name is just an unknown column.
+        DatabaseConnection::CopyWriter badName(*db);
+        assert(!badName.begin("test_table", {"name) FROM STDIN; DELETE FROM test_table; --"}));
+        assert(!badName.getError().empty());
+        assert(db->isConnected());
+
+        result = db->executeQuery("SELECT COUNT(*) as total FROM test_table WHERE name LIKE 'Copy Failing %'");
+        assert(result != nullptr);
+        DatabaseResult failedRows(result);
+        assert(failedRows.next());
+        assert(failedRows.getInt("total") == 0);
+
+        assert(db->executeNonQuery("DELETE FROM test_table WHERE name LIKE 'Copy %'"));
+
+        std::cout << "✓ COPY bulk loading tests passed" << std::endl;
+    }
+
+    void testCopyOut() {
+        std::cout << "Testing COPY TO STDOUT export..." << std::endl;
+
+        assert(db->executeNonQuery("INSERT INTO test_table (name, age) VALUES ('Export, \"quoted\"', 40)"));
+
+        std::ostringstream csv;
+        assert(db->copyOut("COPY (SELECT name, age FROM test_table WHERE name LIKE 'Export%') TO STDOUT WITH (FORMAT csv, HEADER)", csv));
+        assert(csv.str() == "name,age\n\"Export, \"\"quoted\"\"\",40\n");
+
+        FILE* file = tmpfile();
+        assert(file != nullptr);
+        assert(db->copyOut("COPY (SELECT age FROM test_table WHERE name LIKE 'Export%') TO STDOUT", fileno(file)));
+        rewind(file);
+        char buffer[16] = {0};
+        assert(fgets(buffer, sizeof(buffer), file) != nullptr);
+        assert(std::string(buffer) == "40\n");
+        fclose(file);
+
+        std::ostringstream failed;
+        assert(!db->copyOut("COPY (SELECT * FROM nonexistent_table) TO STDOUT", failed));
+        assert(db->ping());
+
+        assert(db->executeNonQuery("DELETE FROM test_table WHERE name LIKE 'Export%'"));
+
+        std::cout << "✓ COPY TO STDOUT tests passed" << std::endl;
+    }
+
+    void testQueryStatistics() {
+        std::cout << "Testing per-statement statistics..." << std::endl;
+
+        std::shared_ptr<QueryStatistics> previous = db->getStatistics();
+        std::shared_ptr<QueryStatistics> stats = std::make_shared<QueryStatistics>();
+        db->setStatistics(stats);
+
+        for (int i = 0; i < 3; i++) {
+            PGresult* result = db->executeParameterizedQuery("SELECT name FROM test_table WHERE age > $1",
+                                                             {std::to_string(i)});
+            assert(result != nullptr);
+            PQclear(result);
+        }
+        assert(db->executeQuery("SELECT * FROM nonexistent_table") == nullptr);
+
+        std::vector<QueryStatsEntry> entries = stats->snapshot();
+        bool sawSelect = false;
+        bool sawFailure = false;
+        for (const auto& entry : entries) {
+            if (entry.query == "SELECT name FROM test_table WHERE age > $1") {
+                sawSelect = true;
+                assert(entry.calls == 3);
+                assert(entry.errors == 0);
+                assert(entry.minMs <= entry.p50Ms && entry.p50Ms <= entry.maxMs);
+            }
+            if (entry.query == "SELECT * FROM nonexistent_table") {
+                sawFailure = true;
+                assert(entry.errors == 1);
+            }
+        }
+        assert(sawSelect);
+        assert(sawFailure);
+
+        db->setStatistics(previous);
+
+        std::cout << "✓ Statement statistics tests passed" << std::endl;
+    }
+
+    void terminateBackend() {
+        PGresult* result = db->executeQuery("SELECT pg_backend_pid() as pid");
+        assert(result != nullptr);
+        DatabaseResult pidResult(result);
+        assert(pidResult.next());
+        std::string pid = pidResult.getString("pid");
+
+        DatabaseConnection admin("localhost", "5432", "rezz_test_db", "postgres", "postgres");
+        if (!admin.connect()) {
+            assert(admin.connect("localhost", "5432", "rezz_db", "postgres", "postgres"));
+        }
+        PGresult* terminated = admin.executeParameterizedQuery("SELECT pg_terminate_backend($1::int)", {pid});
+        assert(terminated != nullptr);
+        PQclear(terminated);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    void testNotifications() {
+        std::cout << "Testing LISTEN/NOTIFY cache invalidation..." << std::endl;
+
+        std::shared_ptr<DatabaseConnection> listener =
+            std::make_shared<DatabaseConnection>("localhost", "5432", "rezz_test_db", "postgres", "postgres");
+        assert(listener->connect());
+        assert(listener->listen("rezz_test_channel"));
+
+        assert(db->executeNonQuery("NOTIFY rezz_test_channel, 'test_table:1'"));
+        std::string received;
+        for (int i = 0; i < 10 && received.empty(); i++) {
+            assert(listener->pollNotifications(100, [&received](const std::string& channel,
+                                                                const std::string& payload, int) {
+                assert(channel == "rezz_test_channel");
+                received = payload;
+            }));
+        }
+        assert(received == "test_table:1");
+        assert(listener->unlisten("rezz_test_channel"));
+        listener->disconnect();
+
+        // A notification from another session evicts the cached reads of
+        // the named table only.
+        std::shared_ptr<QueryCache> cache = std::make_shared<QueryCache>();
+        CacheInvalidationListener invalidations(
+            std::make_shared<DatabaseConnection>("localhost", "5432", "rezz_test_db", "postgres", "postgres"), cache);
+        assert(invalidations.start());
+
+        db->setResultCache(cache);
+        PGresult* result = db->executeQuery("SELECT COUNT(*) FROM test_table");
+        assert(result != nullptr);
+        PQclear(result);
+        result = db->executeQuery("SELECT 1 FROM pg_class LIMIT 1");
+        assert(result != nullptr);
+        PQclear(result);
+        // Locking reads are never served from the cache.
+        result = db->executeQuery("SELECT name FROM test_table FOR SHARE");
+        assert(result != nullptr);
+        PQclear(result);
+        result = db->executeQuery("SELECT name FROM test_table FOR UPDATE");
+        assert(result != nullptr);
+        PQclear(result);
+        db->setResultCache(nullptr);
+        assert(cache->getStats().entries == 2);
+
+        assert(db->executeNonQuery("SELECT pg_notify('rezz_table_changes', 'test_table')"));
+        for (int i = 0; i < 50 && invalidations.getNotificationCount() == 0; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        assert(invalidations.getNotificationCount() == 1);
+        assert(cache->getStats().entries == 1);
+        invalidations.stop();
+        assert(!invalidations.isRunning());
+
+        std::cout << "✓ LISTEN/NOTIFY tests passed" << std::endl;
+    }
+
+    void testReconnect() {
+        std::cout << "Testing automatic reconnect..." << std::endl;
+
+        DatabaseConnection::ReconnectPolicy previous = db->getReconnectPolicy();
+        DatabaseConnection::ReconnectPolicy policy;
+        policy.initialBackoff = std::chrono::milliseconds(10);
+        db->setReconnectPolicy(policy);
+
+        std::string countQuery = "SELECT COUNT(*) as total FROM test_table WHERE age >= $1";
+        PGresult* result = db->executeParameterizedQuery(countQuery, {"0"});
+        assert(result != nullptr);
+        PQclear(result);
+        size_t prepared = db->getPreparedStatementCount();
+
+        // A read on a dropped connection is retried transparently, and the
+        // statement cache is re-prepared on the new session.
+        terminateBackend();
+        result = db->executeParameterizedQuery(countQuery, {"0"});
+        assert(result != nullptr);
+        PQclear(result);
+        assert(db->isConnected());
+        assert(db->getPreparedStatementCount() == prepared);
+
+        terminateBackend();
+        result = db->executeQuery("SELECT 1 as value");
+        assert(result != nullptr);
+        PQclear(result);
+
+        // Writes are not retried, but the next call reconnects.
+        terminateBackend();
+        assert(!db->executeParameterizedNonQuery("INSERT INTO test_table (name, age) VALUES ($1, $2)",
+                                                 {"Reconnect Write", "1"}));
+        result = db->executeQuery("SELECT COUNT(*) as total FROM test_table WHERE name = 'Reconnect Write'");
+        assert(result != nullptr);
+        DatabaseResult writes(result);
+        assert(writes.next());
+        assert(writes.getInt("total") == 0);
+
+        // Inside a transaction nothing reconnects until the caller ends it,
+        // so the rest of the transaction cannot run in autocommit.
+        assert(db->beginTransaction());
+        assert(db->executeNonQuery("INSERT INTO test_table (name, age) VALUES ('Reconnect Txn 1', 1)"));
+        terminateBackend();
+        assert(!db->executeNonQuery("INSERT INTO test_table (name, age) VALUES ('Reconnect Txn 2', 2)"));
+        assert(!db->executeNonQuery("INSERT INTO test_table (name, age) VALUES ('Reconnect Txn 3', 3)"));
+        assert(db->inTransaction());
+        assert(!db->commitTransaction());
+        assert(!db->inTransaction());
+        result = db->executeQuery("SELECT COUNT(*) as total FROM test_table WHERE name LIKE 'Reconnect Txn%'");
+        assert(result != nullptr);
+        DatabaseResult transactional(result);
+        assert(transactional.next());
+        assert(transactional.getInt("total") == 0);
+
+        // An explicit disconnect is respected.
+        db->disconnect();
+        assert(db->executeQuery("SELECT 1") == nullptr);
+        assert(db->connect());
+
+        db->setReconnectPolicy(previous);
+
+        std::cout << "✓ Automatic reconnect tests passed" << std::endl;
+    }
+
     void cleanupTestTable() {
         std::cout << "Cleaning up test table..." << std::endl;
         db->executeNonQuery("DROP TABLE IF EXISTS test_table");
@@ -307,6 +1039,20 @@ public:
             testDatabaseResult();
             testErrorHandling();
             testStringEscaping();
+            testPreparedStatementCache();
+            testTypedExecute();
+            testBatch();
+            testAsyncQueries();
+            testForEachRow();
+            testBinaryResults();
+            testStringViewAccessors();
+            testRowSet();
+            testTypedColumns();
+            testCopyWriter();
+            testCopyOut();
+            testQueryStatistics();
+            testNotifications();
+            testReconnect();
             cleanupTestTable();
 
             std::cout << "\n✓ All database tests passed successfully!" << std::endl;
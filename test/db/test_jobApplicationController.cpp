@@ -1,4 +1,5 @@
 #include <iostream>
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <vector>
@@ -12,16 +13,20 @@ private:
 
 public:
     JobApplicationControllerTest() {
-        controller = std::make_unique<JobApplicationController>();
-
-        auto db = DatabaseConnection::getInstance();
-        if (!db->connect("localhost", "5432", "rezz_test_db", "postgres", "postgres")) {
+        ConnectionPoolConfig config;
+        config.dbname = "rezz_test_db";
+        auto pool = std::make_shared<ConnectionPool>(config);
+        if (!pool->initialize()) {
             std::cerr << "Warning: Could not connect to test database. Using default connection." << std::endl;
-            if (!db->connect()) {
+            pool = std::make_shared<ConnectionPool>();
+            if (!pool->initialize()) {
                 std::cerr << "Error: Could not connect to any database!" << std::endl;
                 exit(1);
             }
         }
+        ConnectionPool::setInstance(pool);
+
+        controller = std::make_unique<JobApplicationController>();
     }
 
     ~JobApplicationControllerTest() {
@@ -198,6 +203,161 @@ public:
         std::cout << "✓ Interview and follow-up date addition tests passed" << std::endl;
     }
 
+    void testListsLoadChildDates() {
+        std::cout << "Testing child dates on listed applications..." << std::endl;
+
+        // The quote and backslash exercise the array literal used to batch the child lookups.
+        std::vector<std::string> ids = {"TEST_APP_LIST_1", "TEST_APP_LIST_\"2\\", "TEST_APP_LIST_3"};
+        for (size_t i = 0; i < ids.size(); i++) {
+            JobApplication app(ids[i], "JOB_LIST", "Engineer", "ListCorp", "2024-03-0" + std::to_string(i + 1));
+            for (size_t d = 0; d < i; d++) {
+                app.addInterviewDate("2024-04-1" + std::to_string(d));
+            }
+            app.addFollowUpDate("2024-05-0" + std::to_string(i + 1));
+            assert(controller->createJobApplication(app));
+            testApplicationIds.push_back(ids[i]);
+        }
+
+        auto apps = controller->getJobApplicationsByCompany("ListCorp");
+        assert(apps.size() == ids.size());
+        for (const auto& app : apps) {
+            size_t i = std::find(ids.begin(), ids.end(), app->getApplicationId()) - ids.begin();
+            assert(i < ids.size());
+            assert(app->getInterviewDates().size() == i);
+            assert((app->getFollowUpDates() == std::vector<std::string>{"2024-05-0" + std::to_string(i + 1)}));
+        }
+        assert((apps.back()->getInterviewDates().empty()));
+        assert((apps.front()->getInterviewDates() == std::vector<std::string>{"2024-04-10", "2024-04-11"}));
+
+        std::cout << "✓ Child dates on listed applications tests passed" << std::endl;
+    }
+
+    void testPaginatedListing() {
+        std::cout << "Testing paginated listing..." << std::endl;
+
+        for (int i = 0; i < 5; i++) {
+            std::string id = "TEST_APP_PAGE_" + std::to_string(i);
+            // Two rows per date, so pages have to break ties on id.
+            JobApplication app(id, "JOB_PAGE", "Engineer", "PageCorp", "2024-06-0" + std::to_string(1 + i / 2));
+            assert(controller->createJobApplication(app));
+            testApplicationIds.push_back(id);
+        }
+
+        auto all = controller->getJobApplicationsByCompany("PageCorp");
+        std::vector<std::string> paged;
+        std::string cursor;
+        int pages = 0;
+        do {
+            JobApplicationPage page = controller->getJobApplicationsByCompanyPage("PageCorp", 2, cursor);
+            assert(page.applications.size() <= 2);
+            for (const auto& app : page.applications) {
+                paged.push_back(app->getApplicationId());
+            }
+            cursor = page.nextCursor;
+            pages++;
+        } while (!cursor.empty());
+
+        assert(pages == 3);
+        assert(paged.size() == all.size());
+        // Same order as the full list, ties on a date included.
+        for (size_t i = 0; i < all.size(); i++) {
+            assert(paged[i] == all[i]->getApplicationId());
+            assert(i == 0 || all[i - 1]->getDateApplied() >= all[i]->getDateApplied());
+        }
+
+        std::cout << "✓ Paginated listing tests passed" << std::endl;
+    }
+
+    void testPaginatedListingBinaryResults() {
+        std::cout << "Testing paginated listing with binary results..." << std::endl;
+
+        for (int i = 0; i < 5; i++) {
+            std::string id = "TEST_APP_BINPAGE_" + std::to_string(i);
+            JobApplication app(id, "JOB_PAGE", "Engineer", "BinaryPageCorp", "2024-07-0" + std::to_string(1 + i / 2));
+            assert(controller->createJobApplication(app));
+            testApplicationIds.push_back(id);
+        }
+
+        // A controller of its own on a binary-mode pool, so the cursor is
+        // built from values that do not arrive as text.
+        ConnectionPoolConfig config;
+        config.dbname = "rezz_test_db";
+        config.binaryResults = true;
+        auto pool = std::make_shared<ConnectionPool>(config);
+        if (!pool->initialize()) {
+            ConnectionPoolConfig fallback;
+            fallback.binaryResults = true;
+            pool = std::make_shared<ConnectionPool>(fallback);
+            assert(pool->initialize());
+        }
+        JobApplicationController binaryController(pool);
+
+        std::vector<std::string> paged;
+        std::string cursor;
+        int pages = 0;
+        do {
+            JobApplicationPage page = binaryController.getJobApplicationsByCompanyPage("BinaryPageCorp", 2, cursor);
+            assert(!page.applications.empty());
+            assert(page.applications.size() <= 2);
+            for (const auto& app : page.applications) {
+                paged.push_back(app->getApplicationId());
+            }
+            if (!page.nextCursor.empty()) {
+                assert(page.nextCursor.size() > 11);
+                assert(page.nextCursor.compare(0, 5, "2024-") == 0 && page.nextCursor[10] == '|');
+                assert(page.nextCursor.find_first_not_of("0123456789", 11) == std::string::npos);
+            }
+            cursor = page.nextCursor;
+            pages++;
+        } while (!cursor.empty());
+
+        assert(pages == 3);
+        assert(paged.size() == 5);
+        for (int i = 0; i < 5; i++) {
+            std::string id = "TEST_APP_BINPAGE_" + std::to_string(i);
+            assert(std::count(paged.begin(), paged.end(), id) == 1);
+        }
+
+        std::cout << "✓ Binary-result paginated listing tests passed" << std::endl;
+    }
+
+    void testBulkCreate() {
+        std::cout << "Testing bulk creation..." << std::endl;
+
+        std::vector<JobApplication> apps;
+        for (int i = 0; i < 5; i++) {
+            JobApplication app("TEST_APP_BULK_" + std::to_string(i), "", "Engineer", "BulkCorp", "2024-07-01");
+            app.addInterviewDate("2024-07-1" + std::to_string(i));
+            app.addFollowUpDate("2024-07-20");
+            apps.push_back(app);
+        }
+        apps.push_back(JobApplication("TEST_APP_BULK_0", "", "Engineer", "BulkCorp", "2024-07-01"));  // repeated in input
+        apps.push_back(JobApplication("TEST_APP_BULK_D", "", "Engineer", "BulkCorp", "not-a-date"));  // server rejects
+        apps.push_back(JobApplication("TEST_APP_001", "", "Engineer", "BulkCorp", "2024-07-01"));     // already stored
+        apps.push_back(JobApplication("TEST_APP_BULK_X", "", "Engineer", "", "2024-07-01"));          // no company
+        for (int i = 0; i < 5; i++) {
+            testApplicationIds.push_back("TEST_APP_BULK_" + std::to_string(i));
+        }
+
+        // The bad date shares a batch with TEST_APP_BULK_4, which must still be stored.
+        BulkCreateResult result = controller->createJobApplications(apps, 2);
+        assert(result.created == 5);
+        assert(result.failures.size() == 4);
+        assert(result.failures[0].first == 5);
+        assert(result.failures[1].first == 6);
+        assert(result.failures[2].first == 7);
+        assert(result.failures[3].first == 8);
+
+        auto stored = controller->getJobApplicationsByCompany("BulkCorp");
+        assert(stored.size() == 5);
+        for (const auto& app : stored) {
+            assert(app->getInterviewDates().size() == 1);
+            assert((app->getFollowUpDates() == std::vector<std::string>{"2024-07-20"}));
+        }
+
+        std::cout << "✓ Bulk creation tests passed" << std::endl;
+    }
+
     void testGetJobApplicationCount() {
         std::cout << "Testing JobApplication count..." << std::endl;
 
@@ -347,6 +507,45 @@ public:
         std::cout << "✓ Edge case tests passed" << std::endl;
     }
 
+    void testUpsertAndDateSync() {
+        std::cout << "Testing upsert and child date sync..." << std::endl;
+
+        JobApplication app("TEST_APP_UPSERT", "", "Engineer", "UpsertCorp", "2024-08-01");
+        app.addInterviewDate("2024-08-05");
+        app.addInterviewDate("2024-08-07");
+        app.addFollowUpDate("2024-08-10");
+        assert(controller->upsertJobApplication(app));
+        testApplicationIds.push_back("TEST_APP_UPSERT");
+
+        // Second upsert takes the update path: one date kept, one dropped, one added.
+        app.setStatus(ApplicationStatus::INTERVIEWING);
+        app.clearInterviewDates();
+        app.addInterviewDate("2024-08-07");
+        app.addInterviewDate("2024-08-12");
+        app.addInterviewDate("2024-08-12");
+        assert(controller->upsertJobApplication(app));
+
+        auto stored = controller->getJobApplicationById("TEST_APP_UPSERT");
+        assert(stored != nullptr);
+        assert(stored->getStatus() == ApplicationStatus::INTERVIEWING);
+        assert((stored->getInterviewDates() == std::vector<std::string>{"2024-08-07", "2024-08-12"}));
+        assert((stored->getFollowUpDates() == std::vector<std::string>{"2024-08-10"}));
+
+        // Unchanged update still succeeds; clearing dates removes every child row.
+        assert(controller->updateJobApplication(*stored));
+        stored->clearInterviewDates();
+        assert(controller->updateJobApplication(*stored));
+        assert(controller->getJobApplicationById("TEST_APP_UPSERT")->getInterviewDates().empty());
+
+        JobApplication missing("TEST_APP_MISSING", "", "Engineer", "UpsertCorp", "2024-08-01");
+        assert(!controller->updateJobApplication(missing));
+        missing.addInterviewDate("2024-08-05");
+        assert(!controller->updateJobApplication(missing));
+        assert(!controller->jobApplicationExists("TEST_APP_MISSING"));
+
+        std::cout << "✓ Upsert and child date sync tests passed" << std::endl;
+    }
+
     void runAllTests() {
         std::cout << "=== JobApplicationController Database Tests ===" << std::endl;
 
@@ -359,6 +558,11 @@ public:
             testGetJobApplicationsByDateRange();
             testUpdateJobApplicationStatus();
             testAddInterviewAndFollowUpDates();
+            testListsLoadChildDates();
+            testPaginatedListing();
+            testPaginatedListingBinaryResults();
+            testBulkCreate();
+            testUpsertAndDateSync();
             testGetJobApplicationCount();
             testJobApplicationExists();
             testExportToJson();
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../src/db/jobApplicationQuery.h"
+
+class JobApplicationQueryTest {
+private:
+    static std::unique_ptr<JobApplication> makeApplication(const std::string& id, const std::string& company,
+                                                           const std::string& dateApplied, ApplicationStatus status,
+                                                           const std::string& referral = "") {
+        std::unique_ptr<JobApplication> application(new JobApplication(id, "job-" + id, "Engineer", company, dateApplied));
+        application->setStatus(status);
+        application->setReferralSource(referral);
+        return application;
+    }
+
+public:
+    void testSqlShape() {
+        std::cout << "Testing SQL generation..." << std::endl;
+
+        std::vector<std::string> params;
+        std::string sql = JobApplicationQuery().toSql(params);
+        assert(sql == "SELECT ja.* FROM job_applications ja ORDER BY ja.date_applied DESC, ja.application_id COLLATE \"C\" DESC");
+        assert(params.empty());
+
+        JobApplicationQuery query;
+        query.company("Acme").statuses({ApplicationStatus::APPLIED, ApplicationStatus::REVIEWING})
+             .appliedBetween("2024-01-01", "2024-03-31").referralSource("LinkedIn").withInterview()
+             .orderBy(JobApplicationQuery::Order::COMPANY).limit(25);
+        sql = query.toSql(params);
+        assert(sql == "SELECT ja.* FROM job_applications ja"
+                      " WHERE LOWER(ja.company) LIKE LOWER($1)"
+                      " AND ja.status = ANY($2::integer[])"
+                      " AND ja.date_applied >= $3::date"
+                      " AND ja.date_applied <= $4::date"
+                      " AND LOWER(ja.referral_source) = LOWER($5)"
+                      " AND EXISTS (SELECT 1 FROM interview_dates i WHERE i.application_id = ja.application_id)"
+                      " ORDER BY LOWER(ja.company), ja.date_applied DESC, ja.application_id COLLATE \"C\" DESC"
+                      " LIMIT $6");
+        assert((params == std::vector<std::string>{"%Acme%", "{1,2}", "2024-01-01", "2024-03-31", "LinkedIn", "25"}));
+
+        // Values never reach the text, so the same filters give the same statement.
+        std::vector<std::string> otherParams;
+        JobApplicationQuery other;
+        other.company("Globex").statuses({ApplicationStatus::REJECTED})
+             .appliedBetween("2023-01-01", "2023-12-31").referralSource("Friend").withInterview()
+             .orderBy(JobApplicationQuery::Order::COMPANY).limit(5);
+        assert(other.toSql(otherParams) == sql);
+
+        params.clear();
+        sql = JobApplicationQuery().withInterview(false).orderBy(JobApplicationQuery::Order::OLDEST_FIRST).toSql(params);
+        assert(sql == "SELECT ja.* FROM job_applications ja"
+                      " WHERE NOT EXISTS (SELECT 1 FROM interview_dates i WHERE i.application_id = ja.application_id)"
+                      " ORDER BY ja.date_applied ASC, ja.application_id COLLATE \"C\" ASC");
+
+        std::cout << "✓ SQL generation test passed" << std::endl;
+    }
+
+    void testMatches() {
+        std::cout << "Testing in-memory matching..." << std::endl;
+
+        auto app = makeApplication("a1", "Acme Corp", "2024-02-10", ApplicationStatus::REVIEWING, "LinkedIn");
+        assert(JobApplicationQuery().matches(*app));
+        assert(JobApplicationQuery().company("acme").matches(*app));
+        assert(!JobApplicationQuery().company("globex").matches(*app));
+        assert(JobApplicationQuery().statuses({ApplicationStatus::APPLIED, ApplicationStatus::REVIEWING}).matches(*app));
+        assert(!JobApplicationQuery().statuses({}).matches(*app));
+        assert(JobApplicationQuery().appliedBetween("2024-02-10", "2024-02-10").matches(*app));
+        assert(!JobApplicationQuery().appliedFrom("2024-02-11").matches(*app));
+        assert(JobApplicationQuery().referralSource("linkedin").matches(*app));
+        assert(!JobApplicationQuery().referralSource("linked").matches(*app));
+        assert(!JobApplicationQuery().withInterview().matches(*app));
+        assert(JobApplicationQuery().withInterview(false).matches(*app));
+        app->addInterviewDate("2024-02-20");
+        assert(JobApplicationQuery().withInterview().matches(*app));
+
+        std::cout << "✓ In-memory matching test passed" << std::endl;
+    }
+
+    void testSortAndLimit() {
+        std::cout << "Testing sort and limit..." << std::endl;
+
+        std::vector<std::unique_ptr<JobApplication>> apps;
+        apps.push_back(makeApplication("a1", "globex", "2024-01-05", ApplicationStatus::APPLIED));
+        apps.push_back(makeApplication("a2", "Acme", "2024-03-01", ApplicationStatus::APPLIED));
+        apps.push_back(makeApplication("a3", "Acme", "2024-02-01", ApplicationStatus::APPLIED));
+
+        JobApplicationQuery().orderBy(JobApplicationQuery::Order::COMPANY).sortAndLimit(apps);
+        assert(apps[0]->getApplicationId() == "a2" && apps[1]->getApplicationId() == "a3" &&
+               apps[2]->getApplicationId() == "a1");
+
+        JobApplicationQuery().orderBy(JobApplicationQuery::Order::OLDEST_FIRST).limit(2).sortAndLimit(apps);
+        assert(apps.size() == 2);
+        assert(apps[0]->getApplicationId() == "a1" && apps[1]->getApplicationId() == "a3");
+
+        // Same date: application_id decides, as in the SQL.
+        std::vector<std::unique_ptr<JobApplication>> tied;
+        tied.push_back(makeApplication("b", "Acme", "2024-04-01", ApplicationStatus::APPLIED));
+        tied.push_back(makeApplication("C", "Acme", "2024-04-01", ApplicationStatus::APPLIED));
+        tied.push_back(makeApplication("a", "Acme", "2024-04-01", ApplicationStatus::APPLIED));
+        JobApplicationQuery().limit(2).sortAndLimit(tied);
+        assert(tied.size() == 2);
+        assert(tied[0]->getApplicationId() == "b" && tied[1]->getApplicationId() == "a");
+
+        std::cout << "✓ Sort and limit test passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "=== JobApplicationQuery Tests ===" << std::endl;
+
+        testSqlShape();
+        testMatches();
+        testSortAndLimit();
+
+        std::cout << "\n✓ All JobApplicationQuery tests passed successfully!" << std::endl;
+    }
+};
+
+int main() {
+    JobApplicationQueryTest test;
+    test.runAllTests();
+    return 0;
+}
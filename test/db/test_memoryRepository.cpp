@@ -0,0 +1,271 @@
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "../../src/db/memoryJobApplicationRepository.h"
+#include "../../src/db/jobApplicationController.h"
+
+class MemoryRepositoryTest {
+private:
+    static JobApplication makeApplication(const std::string& id, const std::string& company,
+                                          const std::string& dateApplied,
+                                          ApplicationStatus status = ApplicationStatus::APPLIED) {
+        JobApplication application(id, "job-" + id, "Engineer", company, dateApplied);
+        application.setStatus(status);
+        return application;
+    }
+
+    static std::vector<std::string> ids(const std::vector<std::unique_ptr<JobApplication>>& applications) {
+        std::vector<std::string> result;
+        for (const auto& application : applications) {
+            result.push_back(application->getApplicationId());
+        }
+        return result;
+    }
+
+    static std::shared_ptr<InMemoryJobApplicationRepository> seeded() {
+        auto repository = std::make_shared<InMemoryJobApplicationRepository>();
+        assert(repository->createJobApplication(makeApplication("a1", "Acme Corp", "2024-01-10")));
+        assert(repository->createJobApplication(makeApplication("a2", "Globex", "2024-02-05", ApplicationStatus::INTERVIEWING)));
+        assert(repository->createJobApplication(makeApplication("a3", "acme corp", "2024-03-01", ApplicationStatus::INTERVIEWING)));
+        assert(repository->createJobApplication(makeApplication("a4", "Initech", "2024-03-20", ApplicationStatus::REJECTED)));
+        return repository;
+    }
+
+public:
+    void testCreateAndGet() {
+        std::cout << "Testing create and get..." << std::endl;
+
+        auto repository = seeded();
+        assert(repository->getJobApplicationCount() == 4);
+        assert(repository->jobApplicationExists("a2"));
+        assert(!repository->jobApplicationExists("missing"));
+
+        // Duplicate IDs are rejected, like the primary key.
+        assert(!repository->createJobApplication(makeApplication("a1", "Other", "2024-05-01")));
+        assert(repository->getJobApplicationById("a1")->getCompany() == "Acme Corp");
+        assert(repository->getJobApplicationById("missing") == nullptr);
+
+        // Newest first.
+        assert((ids(repository->getAllJobApplications()) == std::vector<std::string>{"a4", "a3", "a2", "a1"}));
+
+        std::cout << "✓ Create and get test passed" << std::endl;
+    }
+
+    void testFilters() {
+        std::cout << "Testing filtered queries..." << std::endl;
+
+        auto repository = seeded();
+        assert((ids(repository->getJobApplicationsByCompany("ACME")) == std::vector<std::string>{"a3", "a1"}));
+        assert((ids(repository->getJobApplicationsByStatus(ApplicationStatus::INTERVIEWING)) ==
+                std::vector<std::string>{"a3", "a2"}));
+        assert(repository->getJobApplicationsByStatus(ApplicationStatus::ACCEPTED).empty());
+
+        // Both ends inclusive.
+        assert((ids(repository->getJobApplicationsByDateRange("2024-02-05", "2024-03-20")) ==
+                std::vector<std::string>{"a4", "a3", "a2"}));
+        assert(repository->getJobApplicationsByDateRange("2024-04-01", "2024-01-01").empty());
+
+        assert((ids(repository->getJobApplicationsByJobId("job-a2")) == std::vector<std::string>{"a2"}));
+        assert(repository->getJobApplicationCountByStatus(ApplicationStatus::INTERVIEWING) == 2);
+        assert(repository->getJobApplicationCountByStatus(ApplicationStatus::OFFER_RECEIVED) == 0);
+
+        std::cout << "✓ Filtered queries test passed" << std::endl;
+    }
+
+    void testUpdates() {
+        std::cout << "Testing updates..." << std::endl;
+
+        auto repository = seeded();
+        assert(repository->updateJobApplicationStatus("a1", ApplicationStatus::OFFER_RECEIVED));
+        assert(repository->getJobApplicationCountByStatus(ApplicationStatus::APPLIED) == 0);
+        assert((ids(repository->getJobApplicationsByStatus(ApplicationStatus::OFFER_RECEIVED)) ==
+                std::vector<std::string>{"a1"}));
+
+        // Moving the date must move the application in every index.
+        JobApplication moved = makeApplication("a1", "Acme Corp", "2024-04-01", ApplicationStatus::ACCEPTED);
+        moved.addInterviewDate("2024-04-10");
+        moved.addInterviewDate("2024-04-03");
+        assert(repository->updateJobApplication(moved));
+        assert(ids(repository->getAllJobApplications()).front() == "a1");
+        assert(repository->getJobApplicationsByStatus(ApplicationStatus::OFFER_RECEIVED).empty());
+        assert(repository->getJobApplicationsByDateRange("2024-01-01", "2024-01-31").empty());
+        assert(!repository->updateJobApplication(makeApplication("missing", "X", "2024-01-01")));
+
+        assert(repository->addInterviewDate("a1", "2024-04-05"));
+        assert(!repository->addInterviewDate("missing", "2024-04-05"));
+        assert(repository->addFollowUpDate("a1", "2024-04-20"));
+        auto application = repository->getJobApplicationById("a1");
+        assert((application->getInterviewDates() == std::vector<std::string>{"2024-04-03", "2024-04-05", "2024-04-10"}));
+        assert((application->getFollowUpDates() == std::vector<std::string>{"2024-04-20"}));
+
+        std::cout << "✓ Updates test passed" << std::endl;
+    }
+
+    void testDeletes() {
+        std::cout << "Testing deletes..." << std::endl;
+
+        auto repository = seeded();
+        assert(repository->deleteJobApplication("a2"));
+        assert(repository->deleteJobApplication("a2"));
+        assert(repository->getJobApplicationsByJobId("job-a2").empty());
+
+        // Exact match, ignoring case; "Acme" alone would not match.
+        assert(repository->deleteJobApplicationsByCompany("Acme"));
+        assert(repository->getJobApplicationCount() == 3);
+        assert(repository->deleteJobApplicationsByCompany("ACME CORP"));
+        assert((ids(repository->getAllJobApplications()) == std::vector<std::string>{"a4"}));
+        assert(repository->getJobApplicationCountByStatus(ApplicationStatus::INTERVIEWING) == 0);
+
+        repository->clear();
+        assert(repository->getJobApplicationCount() == 0);
+
+        std::cout << "✓ Deletes test passed" << std::endl;
+    }
+
+    void testConcurrentAccess() {
+        std::cout << "Testing concurrent access..." << std::endl;
+
+        auto repository = std::make_shared<InMemoryJobApplicationRepository>();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([repository, t]() {
+                for (int i = 0; i < 250; i++) {
+                    std::string id = "t" + std::to_string(t) + "-" + std::to_string(i);
+                    bool created = repository->createJobApplication(makeApplication(id, "Acme", "2024-01-01"));
+                    assert(created);
+                    repository->getJobApplicationsByStatus(ApplicationStatus::APPLIED);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        assert(repository->getJobApplicationCount() == 1000);
+        assert(repository->getJobApplicationCountByStatus(ApplicationStatus::APPLIED) == 1000);
+
+        std::cout << "✓ Concurrent access test passed" << std::endl;
+    }
+
+    void testController() {
+        std::cout << "Testing controller over a repository..." << std::endl;
+
+        // The repository owns any connection; the controller leases none.
+        static_assert(!std::is_base_of<DatabaseClient, JobApplicationController>::value,
+                      "JobApplicationController must not hold database connections");
+
+        JobApplicationController controller(seeded());
+        assert(controller.getJobApplicationCount() == 4);
+
+        JobApplication created = makeApplication("a5", "Hooli", "2024-04-02");
+        created.setNotes("Said \"hi\", then left");
+        created.addFollowUpDate("2024-04-09");
+        created.addFollowUpDate("2024-04-08");
+        assert(controller.createJobApplication(created));
+        assert(controller.getJobApplicationsByCompany("hoo").size() == 1);
+
+        std::map<ApplicationStatus, int> counts =
+            controller.getJobApplicationCountsByStatus({ApplicationStatus::APPLIED, ApplicationStatus::INTERVIEWING});
+        assert(counts[ApplicationStatus::APPLIED] == 2);
+        assert(counts[ApplicationStatus::INTERVIEWING] == 2);
+
+        std::string csv = controller.exportToCsv();
+        assert(csv.find("Application ID,Job ID,Job Title,Company,Date Applied,Status,") == 0);
+        assert(csv.find("a5,job-a5,Engineer,Hooli,2024-04-02,APPLIED,") != std::string::npos);
+        assert(csv.find("\"Said \"\"hi\"\", then left\"") != std::string::npos);
+        assert(csv.find("2024-04-08;2024-04-09") != std::string::npos);
+        assert(csv.find("a5") < csv.find("a4"));
+
+        std::string json = controller.exportToJson();
+        assert(json.find("\"a5\"") != std::string::npos);
+        assert(json.find("\"a1\"") != std::string::npos);
+
+        JobApplicationQuery query;
+        query.company("acme").status(ApplicationStatus::INTERVIEWING).limit(5);
+        auto found = controller.findJobApplications(query);
+        assert((ids(found) == std::vector<std::string>{"a3"}));
+
+        BulkCreateResult bulk = controller.createJobApplications(
+            {makeApplication("b1", "Bulk", "2024-05-01"), makeApplication("a1", "Bulk", "2024-05-01")});
+        assert(bulk.created == 1);
+        assert(bulk.failures.size() == 1 && bulk.failures[0].first == 1);
+
+        JobApplication upserted = makeApplication("a6", "Upsert", "2024-05-02");
+        assert(controller.upsertJobApplication(upserted));
+        upserted.setStatus(ApplicationStatus::REVIEWING);
+        assert(controller.upsertJobApplication(upserted));
+        assert(controller.getJobApplicationById("a6")->getStatus() == ApplicationStatus::REVIEWING);
+
+        assert(controller.deleteJobApplication("a5"));
+        assert(controller.getJobApplicationById("a5") == nullptr);
+
+        std::cout << "✓ Controller test passed" << std::endl;
+    }
+
+    void testPagination() {
+        std::cout << "Testing paginated listings..." << std::endl;
+
+        auto repository = std::make_shared<InMemoryJobApplicationRepository>();
+        for (int i = 0; i < 25; i++) {
+            std::string id = "p" + std::string(i < 10 ? "0" : "") + std::to_string(i);
+            // Pairs share a date so the cursor has to break ties on the ID.
+            std::string day = std::to_string(10 + i / 2);
+            assert(repository->createJobApplication(makeApplication(id, "Pager", "2024-01-" + day,
+                i % 3 == 0 ? ApplicationStatus::REJECTED : ApplicationStatus::APPLIED)));
+        }
+        JobApplicationController controller(repository);
+
+        std::vector<std::string> expected = ids(controller.getAllJobApplications());
+        std::vector<std::string> paged;
+        std::string cursor;
+        int pages = 0;
+        do {
+            JobApplicationPage page = controller.getJobApplicationsPage(10, cursor);
+            assert(page.applications.size() <= 10);
+            for (const auto& id : ids(page.applications)) {
+                paged.push_back(id);
+            }
+            cursor = page.nextCursor;
+            pages++;
+        } while (!cursor.empty());
+        assert(pages == 3);
+        assert(paged == expected);
+
+        JobApplicationPage rejected = controller.getJobApplicationsByStatusPage(ApplicationStatus::REJECTED, 5);
+        assert((ids(rejected.applications) == std::vector<std::string>{"p24", "p21", "p18", "p15", "p12"}));
+        rejected = controller.getJobApplicationsByStatusPage(ApplicationStatus::REJECTED, 5, rejected.nextCursor);
+        assert((ids(rejected.applications) == std::vector<std::string>{"p09", "p06", "p03", "p00"}));
+        assert(rejected.nextCursor.empty());
+
+        JobApplicationPage exact = controller.getJobApplicationsByDateRangePage("2024-01-10", "2024-01-11", 4);
+        assert(exact.applications.size() == 4 && exact.nextCursor.empty());
+        assert(controller.getJobApplicationsByCompanyPage("pager", 0).applications.empty());
+        assert(controller.getJobApplicationsPage(10, "not-a-cursor").applications.empty());
+
+        std::cout << "✓ Paginated listings test passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "=== In-Memory Repository Tests ===" << std::endl;
+
+        testCreateAndGet();
+        testFilters();
+        testUpdates();
+        testDeletes();
+        testConcurrentAccess();
+        testController();
+        testPagination();
+
+        std::cout << "\n✓ All in-memory repository tests passed successfully!" << std::endl;
+    }
+};
+
+int main() {
+    MemoryRepositoryTest test;
+    test.runAllTests();
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../src/db/queryCache.h"
+
+class QueryCacheTest {
+private:
+    // One text column named "value" holding `value` in `rows` rows.
+    static PGresult* makeResult(const std::string& value, int rows = 1) {
+        PGresult* result = PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+        PGresAttDesc attribute;
+        std::memset(&attribute, 0, sizeof(attribute));
+        attribute.name = const_cast<char*>("value");
+        attribute.typid = 25;
+        attribute.typlen = -1;
+        attribute.atttypmod = -1;
+        assert(PQsetResultAttrs(result, 1, &attribute));
+        for (int row = 0; row < rows; row++) {
+            assert(PQsetvalue(result, row, 0, const_cast<char*>(value.c_str()), static_cast<int>(value.size())));
+        }
+        return result;
+    }
+
+    static void store(QueryCache& cache, const std::string& query, const std::string& value) {
+        PGresult* result = makeResult(value);
+        cache.store(query, query, result, cache.getGeneration());
+        PQclear(result);
+    }
+
+    static std::string cachedValue(QueryCache& cache, const std::string& query) {
+        PGresult* result = cache.lookup(query);
+        if (!result) {
+            return "";
+        }
+        std::string value = PQgetvalue(result, 0, 0);
+        PQclear(result);
+        return value;
+    }
+
+public:
+    void testTableExtraction() {
+        std::cout << "Testing table extraction..." << std::endl;
+
+        std::vector<std::string> tables = QueryCache::readTables(
+            "SELECT * FROM job_applications a JOIN public.\"Job_Listings\" l ON a.job_id = l.job_id JOIN resumes AS r ON true "
+            "WHERE a.notes <> 'FROM fake' ORDER BY a.date_applied DESC");
+        assert(tables.size() == 3);
+        assert(tables[0] == "job_applications");
+        assert(tables[1] == "Job_Listings");
+        assert(tables[2] == "resumes");
+
+        tables = QueryCache::readTables("SELECT COUNT(*) FROM (SELECT 1 FROM interview_dates) d");
+        assert(tables.size() == 1 && tables[0] == "interview_dates");
+
+        tables.clear();
+        assert(QueryCache::writtenTables("UPDATE job_applications SET status = $2 WHERE application_id = $1", tables));
+        assert(tables.size() == 1 && tables[0] == "job_applications");
+
+        tables.clear();
+        assert(QueryCache::writtenTables("insert into Interview_Dates (application_id) values ($1)", tables));
+        assert(tables.size() == 1 && tables[0] == "interview_dates");
+
+        tables.clear();
+        assert(QueryCache::writtenTables("DELETE FROM ONLY follow_up_dates WHERE id = 1", tables));
+        assert(tables.size() == 1 && tables[0] == "follow_up_dates");
+
+        tables.clear();
+        assert(QueryCache::writtenTables("COPY job_listings (job_id, title) FROM STDIN", tables));
+        assert(tables.size() == 1 && tables[0] == "job_listings");
+
+        tables.clear();
+        assert(QueryCache::writtenTables("TRUNCATE TABLE a, b", tables));
+        assert(tables.size() == 2);
+
+        tables.clear();
+        assert(QueryCache::writtenTables("COMMIT", tables) && tables.empty());
+        assert(QueryCache::writtenTables("COPY (SELECT * FROM t) TO STDOUT", tables) && tables.empty());
+        assert(QueryCache::writtenTables("SELECT * FROM t WHERE id = $1 FOR UPDATE", tables) && tables.empty());
+        assert(QueryCache::writtenTables("SELECT * FROM t FOR KEY SHARE SKIP LOCKED", tables) && tables.empty());
+        assert(!QueryCache::writtenTables("SELECT setval('t_id_seq', 1)", tables));
+        assert(!QueryCache::writtenTables("CREATE OR REPLACE VIEW v AS SELECT 1", tables));
+        assert(!QueryCache::writtenTables("WITH moved AS (DELETE FROM a RETURNING *) INSERT INTO b SELECT * FROM moved",
+                                          tables));
+
+        std::cout << "✓ Table extraction tests passed" << std::endl;
+    }
+
+    void testLookupAndTtl() {
+        std::cout << "Testing lookups and TTL expiry..." << std::endl;
+
+        QueryCacheConfig config;
+        config.ttl = std::chrono::milliseconds(50);
+        QueryCache cache(config);
+
+        assert(cache.lookup("SELECT value FROM t") == nullptr);
+        store(cache, "SELECT value FROM t", "first");
+        assert(cachedValue(cache, "SELECT value FROM t") == "first");
+
+        // Callers own and free what lookup() returns; the entry is unaffected.
+        assert(cachedValue(cache, "SELECT value FROM t") == "first");
+
+        QueryCacheStats stats = cache.getStats();
+        assert(stats.hits == 2);
+        assert(stats.misses == 1);
+        assert(stats.entries == 1);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(80));
+        assert(cache.lookup("SELECT value FROM t") == nullptr);
+        assert(cache.getStats().entries == 0);
+
+        std::cout << "✓ Lookup and TTL tests passed" << std::endl;
+    }
+
+    void testWriteInvalidation() {
+        std::cout << "Testing write invalidation..." << std::endl;
+
+        QueryCache cache;
+        store(cache, "SELECT * FROM job_applications ORDER BY date_applied DESC", "applications");
+        store(cache, "SELECT * FROM job_listings", "listings");
+        store(cache, "SELECT * FROM job_applications a JOIN job_listings l ON a.job_id = l.job_id", "joined");
+
+        cache.invalidateFor("UPDATE job_listings SET title = $2 WHERE job_id = $1");
+        assert(cachedValue(cache, "SELECT * FROM job_applications ORDER BY date_applied DESC") == "applications");
+        assert(cache.lookup("SELECT * FROM job_listings") == nullptr);
+        assert(cache.lookup("SELECT * FROM job_applications a JOIN job_listings l ON a.job_id = l.job_id") == nullptr);
+        assert(cache.getStats().invalidations == 2);
+
+        // A result fetched before an invalidation of its table is not stored.
+        unsigned long long fetchedAt = cache.getGeneration();
+        cache.invalidateTable("job_listings");
+        PGresult* stale = makeResult("stale");
+        cache.store("SELECT * FROM job_listings", "SELECT * FROM job_listings", stale, fetchedAt);
+        PQclear(stale);
+        assert(cache.lookup("SELECT * FROM job_listings") == nullptr);
+
+        // Statements that can't be attributed to tables clear everything.
+        cache.invalidateFor("DO $$ BEGIN PERFORM 1; END $$");
+        assert(cache.getStats().entries == 0);
+
+        std::cout << "✓ Write invalidation tests passed" << std::endl;
+    }
+
+    void testMemoryBudget() {
+        std::cout << "Testing LRU eviction under the memory budget..." << std::endl;
+
+        QueryCacheConfig config;
+        config.maxBytes = 8 * 1024;
+        QueryCache cache(config);
+
+        std::string value(300, 'x');
+        for (int i = 0; i < 20; i++) {
+            store(cache, "SELECT value FROM t WHERE id = " + std::to_string(i), value);
+            // Keep the first entry hot so it survives eviction.
+            assert(cachedValue(cache, "SELECT value FROM t WHERE id = 0") == value);
+        }
+
+        QueryCacheStats stats = cache.getStats();
+        assert(stats.bytes <= config.maxBytes);
+        assert(stats.evictions > 0);
+        assert(cachedValue(cache, "SELECT value FROM t WHERE id = 0") == value);
+        assert(cache.lookup("SELECT value FROM t WHERE id = 1") == nullptr);
+
+        // Results larger than a quarter of the budget are not cached at all.
+        PGresult* large = makeResult(value, 20);
+        cache.store("SELECT big FROM t", "SELECT big FROM t", large, cache.getGeneration());
+        PQclear(large);
+        assert(cache.lookup("SELECT big FROM t") == nullptr);
+
+        std::cout << "✓ Memory budget tests passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "=== Query Cache Tests ===" << std::endl;
+
+        testTableExtraction();
+        testLookupAndTtl();
+        testWriteInvalidation();
+        testMemoryBudget();
+
+        std::cout << "\n✓ All query cache tests passed successfully!" << std::endl;
+    }
+};
+
+int main() {
+    QueryCacheTest test;
+    test.runAllTests();
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../src/db/queryStatistics.h"
+
+class QueryStatisticsTest {
+private:
+    std::shared_ptr<QueryStatistics> stats;
+
+public:
+    QueryStatisticsTest() : stats(std::make_shared<QueryStatistics>()) {}
+
+    void testNormalize() {
+        std::cout << "Testing query normalization..." << std::endl;
+
+        assert(QueryStatistics::normalize("SELECT  *\n  FROM job_applications\tWHERE id = 42") ==
+               "SELECT * FROM job_applications WHERE id = ?");
+        assert(QueryStatistics::normalize("SELECT * FROM t WHERE name = 'O''Brien' AND x = 1.5") ==
+               "SELECT * FROM t WHERE name = ? AND x = ?");
+        assert(QueryStatistics::normalize("SELECT * FROM table1 WHERE status = $1 LIMIT $2") ==
+               "SELECT * FROM table1 WHERE status = $1 LIMIT $2");
+        assert(QueryStatistics::normalize("SELECT \"Col 1\" FROM t") == "SELECT \"Col 1\" FROM t");
+        assert(QueryStatistics::normalize("\n    SELECT 1\n") == "SELECT ?");
+
+        std::cout << "✓ Normalization tests passed" << std::endl;
+    }
+
+    void testRecordAndSnapshot() {
+        std::cout << "Testing statistics aggregation..." << std::endl;
+
+        stats->reset();
+        for (int i = 1; i <= 100; i++) {
+            stats->record("SELECT * FROM t WHERE id = " + std::to_string(i),
+                          std::chrono::microseconds(i * 1000), 1, 10, false);
+        }
+        stats->record("DELETE FROM t", std::chrono::microseconds(500), 0, 0, true);
+
+        std::vector<QueryStatsEntry> entries = stats->snapshot();
+        assert(entries.size() == 2);
+
+        const QueryStatsEntry& select = entries[0];
+        assert(select.query == "SELECT * FROM t WHERE id = ?");
+        assert(select.calls == 100);
+        assert(select.errors == 0);
+        assert(select.rows == 100);
+        assert(select.bytes == 1000);
+        assert(select.minMs == 1.0);
+        assert(select.maxMs == 100.0);
+        assert(select.totalMs == 5050.0);
+        assert(select.p50Ms == 50.0);
+        assert(select.p99Ms == 99.0);
+
+        assert(entries[1].query == "DELETE FROM t");
+        assert(entries[1].errors == 1);
+
+        std::ostringstream out;
+        stats->dump(out);
+        assert(out.str().find("SELECT * FROM t WHERE id = ?") != std::string::npos);
+        assert(out.str().find("DELETE FROM t") != std::string::npos);
+
+        stats->reset();
+        assert(stats->snapshot().empty());
+
+        std::cout << "✓ Aggregation tests passed" << std::endl;
+    }
+
+    void testDisabledAndThreshold() {
+        std::cout << "Testing disable switch and slow-query threshold..." << std::endl;
+
+        stats->reset();
+        stats->setEnabled(false);
+        stats->record("SELECT 1", std::chrono::microseconds(10), 1, 1, false);
+        assert(stats->snapshot().empty());
+        stats->setEnabled(true);
+
+        stats->setSlowQueryThreshold(std::chrono::milliseconds(5));
+        assert(stats->getSlowQueryThreshold() == std::chrono::milliseconds(5));
+        stats->record("SELECT pg_sleep(0.01)", std::chrono::microseconds(10000), 1, 1, false);
+        assert(stats->snapshot().size() == 1);
+        stats->setSlowQueryThreshold(std::chrono::milliseconds(0));
+
+        std::cout << "✓ Disable and threshold tests passed" << std::endl;
+    }
+
+    void testConcurrentRecording() {
+        std::cout << "Testing concurrent recording..." << std::endl;
+
+        stats->reset();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([this]() {
+                for (int i = 0; i < 1000; i++) {
+                    stats->record("SELECT 1", std::chrono::microseconds(i), 1, 4, false);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        std::vector<QueryStatsEntry> entries = stats->snapshot();
+        assert(entries.size() == 1);
+        assert(entries[0].calls == 4000);
+        assert(entries[0].bytes == 16000);
+
+        std::cout << "✓ Concurrent recording tests passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "=== Query Statistics Tests ===" << std::endl;
+
+        testNormalize();
+        testRecordAndSnapshot();
+        testDisabledAndThreshold();
+        testConcurrentRecording();
+
+        std::cout << "\n✓ All query statistics tests passed successfully!" << std::endl;
+    }
+};
+
+int main() {
+    QueryStatisticsTest test;
+    test.runAllTests();
+    return 0;
+}
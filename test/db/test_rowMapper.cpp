@@ -0,0 +1,127 @@
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../src/db/rowMapper.h"
+#include "../../src/ds/resume/jobApplication.h"
+
+class RowMapperTest {
+private:
+    using Mapper = RowMapper<JobApplication>;
+    using Column = ColumnBinding<JobApplication>;
+
+    Mapper::Bindings bindings;
+
+    // Builds a text-format result in memory so the mapper can be tested
+    // without a server.
+    static PGresult* makeResult(const std::vector<std::string>& columns,
+                                const std::vector<std::vector<const char*>>& rows) {
+        PGresult* result = PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+        std::vector<PGresAttDesc> attributes(columns.size());
+        for (size_t i = 0; i < columns.size(); i++) {
+            std::memset(&attributes[i], 0, sizeof(PGresAttDesc));
+            attributes[i].name = const_cast<char*>(columns[i].c_str());
+            attributes[i].format = 0;
+            attributes[i].typid = 25;
+            attributes[i].typlen = -1;
+            attributes[i].atttypmod = -1;
+        }
+        assert(PQsetResultAttrs(result, static_cast<int>(attributes.size()), attributes.data()));
+
+        for (size_t row = 0; row < rows.size(); row++) {
+            for (size_t field = 0; field < rows[row].size(); field++) {
+                const char* value = rows[row][field];
+                assert(PQsetvalue(result, static_cast<int>(row), static_cast<int>(field),
+                                  const_cast<char*>(value), value ? static_cast<int>(std::strlen(value)) : -1));
+            }
+        }
+        return result;
+    }
+
+public:
+    RowMapperTest() {
+        bindings = {
+            Column::field<&JobApplication::setApplicationId, &JobApplication::getApplicationId>(
+                "application_id", COLUMN_READ | COLUMN_INSERT),
+            Column::field<&JobApplication::setCompany, &JobApplication::getCompany>("company"),
+            Column::field<&JobApplication::setStatus, &JobApplication::getStatus>("status"),
+            Column::field<&JobApplication::setNotes, &JobApplication::getNotes>("notes", COLUMN_INSERT | COLUMN_UPDATE)
+        };
+    }
+
+    void testStatementLists() {
+        std::cout << "Testing generated column and parameter lists..." << std::endl;
+
+        assert(Mapper::columnList(bindings, COLUMN_INSERT) == "application_id, company, status, notes");
+        assert(Mapper::placeholderList(bindings, COLUMN_INSERT) == "$1, $2, $3, $4");
+        assert(Mapper::assignmentList(bindings, COLUMN_UPDATE, 2) == "company = $2, status = $3, notes = $4");
+        assert(Mapper::columnList(bindings, COLUMN_READ) == "application_id, company, status");
+
+        JobApplication application("app-1", "job-1", "Engineer", "Acme", "2024-01-15");
+        application.setStatus(ApplicationStatus::INTERVIEWING);
+        application.setNotes("second round");
+
+        std::vector<std::string> params = {"app-1"};
+        Mapper::appendParams(bindings, COLUMN_UPDATE, application, params);
+        assert(params.size() == 4);
+        assert(params[1] == "Acme");
+        assert(params[2] == "4");
+        assert(params[3] == "second round");
+
+        std::cout << "✓ Statement list tests passed" << std::endl;
+    }
+
+    void testMapRows() {
+        std::cout << "Testing row hydration..." << std::endl;
+
+        // Column order differs from the binding order and includes extras.
+        PGresult* result = makeResult({"status", "extra", "company", "application_id", "notes"}, {
+            {"2", "x", "Acme", "app-1", "ignored"},
+            {"7", "y", "Globex", "app-2", nullptr}
+        });
+
+        DatabaseResult rows(result);
+        Mapper mapper(bindings);
+
+        assert(rows.next());
+        std::unique_ptr<JobApplication> first = mapper.map(rows);
+        assert(first->getApplicationId() == "app-1");
+        assert(first->getCompany() == "Acme");
+        assert(first->getStatus() == ApplicationStatus::REVIEWING);
+        assert(first->getNotes().empty());
+
+        assert(rows.next());
+        JobApplication second;
+        second.setNotes("kept");
+        mapper.map(rows, second);
+        assert(second.getApplicationId() == "app-2");
+        assert(second.getCompany() == "Globex");
+        assert(second.getStatus() == ApplicationStatus::REJECTED);
+        assert(second.getNotes() == "kept");
+
+        // A result missing a bound column leaves that member untouched.
+        DatabaseResult partial(makeResult({"company"}, {{"Initech"}}));
+        assert(partial.next());
+        mapper.map(partial, second);
+        assert(second.getCompany() == "Initech");
+        assert(second.getApplicationId() == "app-2");
+
+        std::cout << "✓ Row hydration tests passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "=== Row Mapper Tests ===" << std::endl;
+
+        testStatementLists();
+        testMapRows();
+
+        std::cout << "\n✓ All row mapper tests passed successfully!" << std::endl;
+    }
+};
+
+int main() {
+    RowMapperTest test;
+    test.runAllTests();
+    return 0;
+}
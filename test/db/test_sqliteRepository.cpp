@@ -0,0 +1,204 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../src/db/sqliteJobApplicationRepository.h"
+#include "../../src/db/jobApplicationController.h"
+
+class SqliteRepositoryTest {
+private:
+    static JobApplication makeApplication(const std::string& id, const std::string& company,
+                                          const std::string& dateApplied,
+                                          ApplicationStatus status = ApplicationStatus::APPLIED) {
+        JobApplication application(id, "job-" + id, "Engineer", company, dateApplied);
+        application.setStatus(status);
+        return application;
+    }
+
+    static std::vector<std::string> ids(const std::vector<std::unique_ptr<JobApplication>>& applications) {
+        std::vector<std::string> result;
+        for (const auto& application : applications) {
+            result.push_back(application->getApplicationId());
+        }
+        return result;
+    }
+
+    static std::shared_ptr<SqliteJobApplicationRepository> seeded() {
+        auto repository = std::make_shared<SqliteJobApplicationRepository>(":memory:");
+        assert(repository->open());
+        assert(repository->createJobApplication(makeApplication("a1", "Acme Corp", "2024-01-10")));
+        assert(repository->createJobApplication(makeApplication("a2", "Globex", "2024-02-05", ApplicationStatus::INTERVIEWING)));
+        assert(repository->createJobApplication(makeApplication("a3", "acme corp", "2024-03-01", ApplicationStatus::INTERVIEWING)));
+        assert(repository->createJobApplication(makeApplication("a4", "Initech", "2024-03-20", ApplicationStatus::REJECTED)));
+        return repository;
+    }
+
+public:
+    void testRoundTrip() {
+        std::cout << "Testing round trip..." << std::endl;
+
+        auto repository = seeded();
+        JobApplication full = makeApplication("a5", "Hooli", "2024-04-02", ApplicationStatus::OFFER_RECEIVED);
+        full.setContactName("Gavin");
+        full.setNotes("Line one\nline 'two'");
+        full.setResponseDeadline("2024-05-01");
+        full.addInterviewDate("2024-04-12");
+        full.addInterviewDate("2024-04-08");
+        full.addFollowUpDate("2024-04-20");
+        assert(repository->createJobApplication(full));
+        assert(!repository->createJobApplication(full));
+
+        auto loaded = repository->getJobApplicationById("a5");
+        assert(loaded != nullptr);
+        assert(loaded->getContactName() == "Gavin");
+        assert(loaded->getNotes() == "Line one\nline 'two'");
+        assert(loaded->getResponseDeadline() == "2024-05-01");
+        assert(loaded->getStatus() == ApplicationStatus::OFFER_RECEIVED);
+        assert((loaded->getInterviewDates() == std::vector<std::string>{"2024-04-08", "2024-04-12"}));
+        assert((loaded->getFollowUpDates() == std::vector<std::string>{"2024-04-20"}));
+        assert(repository->getJobApplicationById("missing") == nullptr);
+
+        std::cout << "✓ Round trip test passed" << std::endl;
+    }
+
+    void testQueries() {
+        std::cout << "Testing queries..." << std::endl;
+
+        auto repository = seeded();
+        assert((ids(repository->getAllJobApplications()) == std::vector<std::string>{"a4", "a3", "a2", "a1"}));
+        assert((ids(repository->getJobApplicationsByCompany("ACME")) == std::vector<std::string>{"a3", "a1"}));
+        assert((ids(repository->getJobApplicationsByStatus(ApplicationStatus::INTERVIEWING)) ==
+                std::vector<std::string>{"a3", "a2"}));
+        assert((ids(repository->getJobApplicationsByDateRange("2024-02-05", "2024-03-20")) ==
+                std::vector<std::string>{"a4", "a3", "a2"}));
+        assert(repository->getJobApplicationCount() == 4);
+        assert(repository->getJobApplicationCountByStatus(ApplicationStatus::INTERVIEWING) == 2);
+        assert(repository->jobApplicationExists("a1"));
+        assert(!repository->jobApplicationExists("missing"));
+
+        std::vector<std::string> visited;
+        assert(repository->forEachJobApplication([&visited](const JobApplication& application) {
+            visited.push_back(application.getApplicationId());
+            return visited.size() < 2;
+        }));
+        assert((visited == std::vector<std::string>{"a4", "a3"}));
+
+        std::cout << "✓ Queries test passed" << std::endl;
+    }
+
+    void testWrites() {
+        std::cout << "Testing writes..." << std::endl;
+
+        auto repository = seeded();
+        JobApplication moved = makeApplication("a1", "Acme Corp", "2024-04-01", ApplicationStatus::ACCEPTED);
+        moved.addInterviewDate("2024-04-03");
+        assert(repository->updateJobApplication(moved));
+        assert(ids(repository->getAllJobApplications()).front() == "a1");
+        assert(!repository->updateJobApplication(makeApplication("missing", "X", "2024-01-01")));
+
+        assert(repository->addInterviewDate("a1", "2024-04-02"));
+        assert(!repository->addInterviewDate("missing", "2024-04-02"));
+        assert(repository->addFollowUpDate("a1", "2024-04-09"));
+        auto application = repository->getJobApplicationById("a1");
+        assert((application->getInterviewDates() == std::vector<std::string>{"2024-04-02", "2024-04-03"}));
+        assert((application->getFollowUpDates() == std::vector<std::string>{"2024-04-09"}));
+
+        assert(repository->updateJobApplicationStatus("a2", ApplicationStatus::WITHDRAWN));
+        assert(repository->getJobApplicationById("a2")->getStatus() == ApplicationStatus::WITHDRAWN);
+
+        // Child rows go with the parent.
+        assert(repository->deleteJobApplication("a1"));
+        assert(repository->createJobApplication(makeApplication("a1", "Acme Corp", "2024-01-10")));
+        assert(repository->getJobApplicationById("a1")->getInterviewDates().empty());
+
+        assert(repository->deleteJobApplicationsByCompany("ACME CORP"));
+        assert((ids(repository->getAllJobApplications()) == std::vector<std::string>{"a4", "a2"}));
+
+        std::cout << "✓ Writes test passed" << std::endl;
+    }
+
+    void testTransactions() {
+        std::cout << "Testing batched transactions..." << std::endl;
+
+        auto repository = seeded();
+        assert(repository->runInTransaction([&repository]() {
+            for (int i = 0; i < 500; i++) {
+                if (!repository->createJobApplication(makeApplication("b" + std::to_string(i), "Batch", "2024-06-01"))) {
+                    return false;
+                }
+            }
+            return true;
+        }));
+        assert(repository->getJobApplicationCount() == 504);
+
+        // One failed write rolls back the whole batch.
+        assert(!repository->runInTransaction([&repository]() {
+            repository->createJobApplication(makeApplication("c1", "Batch", "2024-06-02"));
+            return repository->createJobApplication(makeApplication("a1", "Duplicate", "2024-06-02"));
+        }));
+        assert(!repository->jobApplicationExists("c1"));
+        assert(repository->getJobApplicationCount() == 504);
+
+        std::cout << "✓ Batched transactions test passed" << std::endl;
+    }
+
+    void testPersistence() {
+        std::cout << "Testing on-disk persistence..." << std::endl;
+
+        std::string path = "test_sqlite_repository.db";
+        std::remove(path.c_str());
+        {
+            SqliteJobApplicationRepository repository(path);
+            assert(repository.open());
+            JobApplication application = makeApplication("p1", "Persist", "2024-07-01");
+            application.addFollowUpDate("2024-07-08");
+            assert(repository.createJobApplication(application));
+        }
+        {
+            SqliteJobApplicationRepository repository(path);
+            assert(repository.open());
+            auto application = repository.getJobApplicationById("p1");
+            assert(application != nullptr);
+            assert((application->getFollowUpDates() == std::vector<std::string>{"2024-07-08"}));
+        }
+        std::remove(path.c_str());
+        std::remove((path + "-wal").c_str());
+        std::remove((path + "-shm").c_str());
+
+        std::cout << "✓ On-disk persistence test passed" << std::endl;
+    }
+
+    void testController() {
+        std::cout << "Testing controller over SQLite..." << std::endl;
+
+        JobApplicationController controller(seeded());
+        assert(controller.getJobApplicationCount() == 4);
+        assert(controller.getJobApplicationsByCompany("glob").size() == 1);
+
+        std::string csv = controller.exportToCsv();
+        assert(csv.find("a4,job-a4,Engineer,Initech,2024-03-20,REJECTED,") != std::string::npos);
+
+        std::cout << "✓ Controller test passed" << std::endl;
+    }
+
+    void runAllTests() {
+        std::cout << "=== SQLite Repository Tests ===" << std::endl;
+
+        testRoundTrip();
+        testQueries();
+        testWrites();
+        testTransactions();
+        testPersistence();
+        testController();
+
+        std::cout << "\n✓ All SQLite repository tests passed successfully!" << std::endl;
+    }
+};
+
+int main() {
+    SqliteRepositoryTest test;
+    test.runAllTests();
+    return 0;
+}